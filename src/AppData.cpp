@@ -0,0 +1,97 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <sys/types.h>
+#include <unistd.h>
+#include <pwd.h>
+#include <cstdlib>
+#include <filesystem>
+
+// External
+
+// Project
+#include "./AppData.h"
+
+// Pre-defined
+#ifndef MIRROR_SPEECH_DATA_DIR
+    #define MIRROR_SPEECH_DATA_DIR ""
+#endif
+#ifndef MIRROR_SPEECH_DATA_NAME
+    #define MIRROR_SPEECH_DATA_NAME "de.mrh.mirrorspeech"
+#endif
+
+
+//*************************************************************************************
+// Directory
+//*************************************************************************************
+
+SpeechResult<std::string> AppData::GetDirectory() noexcept
+{
+    try
+    {
+        // @NOTE: Never relative, the working directory is chosen by
+        //        the platform and not by this app!
+        std::string s_Directory = MIRROR_SPEECH_DATA_DIR;
+        
+        if (s_Directory.size() == 0)
+        {
+            const char* p_DataHome = getenv("XDG_DATA_HOME");
+            const char* p_Home = getenv("HOME");
+            
+            if (p_DataHome != NULL && p_DataHome[0] == '/')
+            {
+                s_Directory = p_DataHome;
+            }
+            else
+            {
+                // Apps might be started without a login environment
+                if (p_Home == NULL || p_Home[0] != '/')
+                {
+                    struct passwd* p_User = getpwuid(getuid());
+                    p_Home = p_User != NULL ? p_User->pw_dir : NULL;
+                }
+                
+                if (p_Home == NULL || p_Home[0] != '/')
+                {
+                    return SpeechError{ "AppData", "No home directory for user " + std::to_string(getuid()) };
+                }
+                
+                s_Directory = std::string(p_Home) + "/.local/share";
+            }
+            
+            s_Directory += "/" MIRROR_SPEECH_DATA_NAME;
+        }
+        else if (s_Directory[0] != '/')
+        {
+            return SpeechError{ "AppData", "Data directory is not absolute: " + s_Directory };
+        }
+        
+        std::error_code c_Error;
+        std::filesystem::create_directories(s_Directory, c_Error);
+        
+        if (c_Error || access(s_Directory.c_str(), W_OK) < 0)
+        {
+            return SpeechError{ "AppData", "Data directory " + s_Directory + " is not writable" };
+        }
+        
+        return s_Directory;
+    }
+    catch (std::exception& e)
+    {
+        return SpeechError{ "AppData", std::string(e.what()) };
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef AppData_h
+#define AppData_h
+
+// C / C++
+#include <string>
+
+// External
+
+// Project
+#include "./Module/SpeechResult.h"
+
+
+class AppData
+{
+public:
+    
+    //*************************************************************************************
+    // Directory
+    //*************************************************************************************
+    
+    /**
+     *  Get the directory for persistent app data. The directory is created
+     *  if it does not exist.
+     *
+     *  \return The full path to the writable app data directory.
+     */
+    
+    static SpeechResult<std::string> GetDirectory() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    AppData() noexcept = delete;
+    
+protected:
+    
+};
+
+#endif /* AppData_h */
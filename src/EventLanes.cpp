@@ -0,0 +1,249 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+
+// Project
+#include "./EventLanes.h"
+
+// Pre-defined
+#ifndef EVENT_LANES_DISPATCH_MAX
+    #define EVENT_LANES_DISPATCH_MAX 32
+#endif
+#ifndef EVENT_LANES_STARVATION_MS
+    #define EVENT_LANES_STARVATION_MS 250
+#endif
+#ifndef EVENT_LANES_QUEUE_MAX
+    #define EVENT_LANES_QUEUE_MAX 256
+#endif
+
+// @NOTE: This is part of the app layer and not a module file, adding
+//        jobs reports errors with exceptions!
+
+namespace
+{
+    // Events taken from each lane per dispatch round
+    constexpr size_t p_LaneWeight[EventLanes::LANE_COUNT] = { 8, 4, 1 };
+    
+    const char* p_LaneName[EventLanes::LANE_COUNT] =
+    {
+        "control",
+        "listen",
+        "other"
+    };
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+EventLanes::EventLanes() noexcept
+{
+    for (size_t i = 0; i < LANE_COUNT; ++i)
+    {
+        p_Delay[i] = { 0, 0, 0 };
+        p_Dropped[i] = 0;
+    }
+}
+
+EventLanes::~EventLanes() noexcept
+{}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+EventLanes& EventLanes::Singleton() noexcept
+{
+    static EventLanes c_EventLanes;
+    return c_EventLanes;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void EventLanes::Add(const MRH_Event* p_Event)
+{
+    Entry c_Entry;
+    c_Entry.u32_Type = p_Event->u32_Type;
+    c_Entry.c_Added = std::chrono::steady_clock::now();
+    
+    if (p_Event->p_Data != NULL && p_Event->u32_DataSize > 0)
+    {
+        c_Entry.v_Data.assign(p_Event->p_Data, p_Event->p_Data + p_Event->u32_DataSize);
+    }
+    
+#ifdef EVENT_LANES_FIFO
+    // Arrival order only, delays are still recorded by lane
+    Lane e_Lane = OTHER;
+#else
+    Lane e_Lane = GetLane(c_Entry.u32_Type);
+#endif
+    
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    std::deque<Entry>& dq_Lane = p_Lane[e_Lane];
+    
+    // A flood of events can't grow a lane without limit, the oldest
+    // event is dropped instead
+    // @NOTE: The control and listen lanes only hold the responses the
+    //        flow waits for, a full lane is only reached in FIFO mode
+    if (dq_Lane.size() >= EVENT_LANES_QUEUE_MAX)
+    {
+        ++p_Dropped[GetLane(dq_Lane.front().u32_Type)];
+        dq_Lane.pop_front();
+    }
+    
+    dq_Lane.emplace_back(std::move(c_Entry));
+}
+
+void EventLanes::Dispatch(libmrhab* p_Context) noexcept
+{
+    std::chrono::steady_clock::time_point c_Now = std::chrono::steady_clock::now();
+    
+    {
+        std::lock_guard<std::mutex> c_Guard(c_Mutex);
+        size_t us_Budget = EVENT_LANES_DISPATCH_MAX;
+        
+        try
+        {
+            // Entries waiting too long are taken first, so that the
+            // lower lanes can't starve
+            // @NOTE: One entry per lane, a flooded lane would otherwise
+            //        use the whole budget ahead of the control lane
+            for (size_t i = 0; i < LANE_COUNT && us_Budget > 0; ++i)
+            {
+                if (p_Lane[i].size() > 0 &&
+                    c_Now - p_Lane[i].front().c_Added >= std::chrono::milliseconds(EVENT_LANES_STARVATION_MS))
+                {
+                    v_Dispatch.emplace_back(std::move(p_Lane[i].front()));
+                    p_Lane[i].pop_front();
+                    --us_Budget;
+                }
+            }
+            
+            // Weighted rounds for the rest
+            bool b_Taken = true;
+            
+            while (us_Budget > 0 && b_Taken == true)
+            {
+                b_Taken = false;
+                
+                for (size_t i = 0; i < LANE_COUNT && us_Budget > 0; ++i)
+                {
+                    for (size_t j = 0; j < p_LaneWeight[i] && us_Budget > 0 && p_Lane[i].size() > 0; ++j)
+                    {
+                        v_Dispatch.emplace_back(std::move(p_Lane[i].front()));
+                        p_Lane[i].pop_front();
+                        --us_Budget;
+                        
+                        b_Taken = true;
+                    }
+                }
+            }
+        }
+        catch (std::exception& e)
+        {
+            // Dispatch what was taken, the rest waits
+        }
+    }
+    
+    for (Entry& c_Entry : v_Dispatch)
+    {
+        Delay& c_Delay = p_Delay[GetLane(c_Entry.u32_Type)];
+        MRH_Uint64 u64_DelayUS = std::chrono::duration_cast<std::chrono::microseconds>(c_Now - c_Entry.c_Added).count();
+        
+        ++c_Delay.u64_Dispatched;
+        c_Delay.u64_TotalUS += u64_DelayUS;
+        
+        if (c_Delay.u64_MaxUS < u64_DelayUS)
+        {
+            c_Delay.u64_MaxUS = u64_DelayUS;
+        }
+        
+        MRH_Event c_Event;
+        c_Event.u32_Type = c_Entry.u32_Type;
+        c_Event.p_Data = c_Entry.v_Data.data();
+        c_Event.u32_DataSize = c_Entry.v_Data.size();
+        
+        try
+        {
+            p_Context->AddJob(&c_Event);
+        }
+        catch (MRH_ABException& e)
+        {
+            MRH_ModuleLogger::Singleton().Log("EventLanes", "Failed to add event job: " +
+                                                            e.what2(),
+                                              "EventLanes.cpp", __LINE__);
+        }
+    }
+    
+    v_Dispatch.clear();
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+EventLanes::Lane EventLanes::GetLane(MRH_Uint32 u32_Type) noexcept
+{
+    switch (u32_Type)
+    {
+        case MRH_EVENT_SAY_STRING_S:
+            return CONTROL;
+        
+        case MRH_EVENT_LISTEN_STRING_S:
+            return LISTEN;
+        
+        // @NOTE: The route only passes types the flow awaits
+        default:
+            return OTHER;
+    }
+}
+
+MRH_Uint64 EventLanes::GetDispatchedCount(Lane e_Lane) noexcept
+{
+    return p_Delay[e_Lane].u64_Dispatched;
+}
+
+MRH_Uint64 EventLanes::GetDroppedCount(Lane e_Lane) noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    return p_Dropped[e_Lane];
+}
+
+MRH_Uint64 EventLanes::GetMeanDelay(Lane e_Lane) noexcept
+{
+    if (p_Delay[e_Lane].u64_Dispatched == 0)
+    {
+        return 0;
+    }
+    
+    return p_Delay[e_Lane].u64_TotalUS / p_Delay[e_Lane].u64_Dispatched;
+}
+
+MRH_Uint64 EventLanes::GetMaxDelay(Lane e_Lane) noexcept
+{
+    return p_Delay[e_Lane].u64_MaxUS;
+}
+
+const char* EventLanes::GetLaneName(Lane e_Lane) noexcept
+{
+    return p_LaneName[e_Lane];
+}
@@ -0,0 +1,206 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef EventLanes_h
+#define EventLanes_h
+
+// C / C++
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <chrono>
+
+// External
+#include <libmrhab.h>
+
+// Project
+
+
+class EventLanes
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    enum Lane
+    {
+        CONTROL = 0,
+        LISTEN = 1,
+        OTHER = 2,
+        
+        LANE_MAX = OTHER,
+        
+        LANE_COUNT = LANE_MAX + 1
+    };
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static EventLanes& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Add a received event to the lane for its type. The event is copied.
+     *  The oldest event of a full lane is dropped.
+     *
+     *  \param p_Event The received event.
+     */
+    
+    void Add(const MRH_Event* p_Event);
+    
+    /**
+     *  Add queued events as jobs, higher priority lanes first.
+     *
+     *  \param p_Context The app base library to add jobs to.
+     */
+    
+    void Dispatch(libmrhab* p_Context) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of events dispatched from a lane.
+     *
+     *  \param e_Lane The lane to get the count for.
+     *
+     *  \return The dispatched event count.
+     */
+    
+    MRH_Uint64 GetDispatchedCount(Lane e_Lane) noexcept;
+    
+    /**
+     *  Get the amount of events of a lane dropped from a full lane.
+     *
+     *  \param e_Lane The lane to get the count for.
+     *
+     *  \return The dropped event count.
+     */
+    
+    MRH_Uint64 GetDroppedCount(Lane e_Lane) noexcept;
+    
+    /**
+     *  Get the mean queueing delay of a lane.
+     *
+     *  \param e_Lane The lane to get the delay for.
+     *
+     *  \return The mean delay in microseconds.
+     */
+    
+    MRH_Uint64 GetMeanDelay(Lane e_Lane) noexcept;
+    
+    /**
+     *  Get the highest queueing delay of a lane.
+     *
+     *  \param e_Lane The lane to get the delay for.
+     *
+     *  \return The highest delay in microseconds.
+     */
+    
+    MRH_Uint64 GetMaxDelay(Lane e_Lane) noexcept;
+    
+    /**
+     *  Get the name of a lane.
+     *
+     *  \param e_Lane The lane to get the name for.
+     *
+     *  \return The lane name.
+     */
+    
+    static const char* GetLaneName(Lane e_Lane) noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Entry
+    {
+        MRH_Uint32 u32_Type;
+        std::vector<MRH_Uint8> v_Data;
+        std::chrono::steady_clock::time_point c_Added;
+    };
+    
+    struct Delay
+    {
+        MRH_Uint64 u64_Dispatched;
+        MRH_Uint64 u64_TotalUS;
+        MRH_Uint64 u64_MaxUS;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    EventLanes() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~EventLanes() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the lane for a event type.
+     *
+     *  \param u32_Type The event type.
+     *
+     *  \return The event lane.
+     */
+    
+    static Lane GetLane(MRH_Uint32 u32_Type) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // @NOTE: Events are added on the platform thread and dispatched
+    //        on the module update thread
+    std::deque<Entry> p_Lane[LANE_COUNT];
+    Delay p_Delay[LANE_COUNT];
+    MRH_Uint64 p_Dropped[LANE_COUNT];
+    std::mutex c_Mutex;
+    
+    // Taken entries, only used by Dispatch()
+    std::vector<Entry> v_Dispatch;
+    
+protected:
+    
+};
+
+#endif /* EventLanes_h */
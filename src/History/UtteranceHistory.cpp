@@ -0,0 +1,531 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+// External
+
+// Project
+#include "./UtteranceHistory.h"
+
+// Pre-defined
+#ifndef UTTERANCE_HISTORY_RECORD_MAX
+    #define UTTERANCE_HISTORY_RECORD_MAX 4096
+#endif
+#ifndef UTTERANCE_HISTORY_GROW_SIZE
+    #define UTTERANCE_HISTORY_GROW_SIZE (64 * 1024)
+#endif
+#ifndef UTTERANCE_HISTORY_FILE_MAX
+    #define UTTERANCE_HISTORY_FILE_MAX (1024 * 1024)
+#endif
+
+namespace
+{
+    constexpr char p_HistoryMagic[8] = { 'M', 'R', 'H', 'U', 'H', 'L', 'O', 'G' };
+    constexpr MRH_Uint32 u32_HistoryVersion = 1;
+    
+    MRH_Uint32 Checksum(const MRH_Uint8* p_Data, size_t us_Size) noexcept
+    {
+        // FNV-1a
+        MRH_Uint32 u32_Hash = 2166136261u;
+        
+        for (size_t i = 0; i < us_Size; ++i)
+        {
+            u32_Hash ^= p_Data[i];
+            u32_Hash *= 16777619u;
+        }
+        
+        return u32_Hash;
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+UtteranceHistory::UtteranceHistory(std::string const& s_FilePath) : s_FilePath(s_FilePath),
+                                                                    i_FileDescriptor(-1),
+                                                                    p_Map(NULL),
+                                                                    us_MapSize(0),
+                                                                    us_End(sizeof(FileHeader)),
+                                                                    u32_IndexHead(0),
+                                                                    u32_IndexCount(0),
+                                                                    b_Run(true)
+{
+    Open();
+    Publish();
+    
+    try
+    {
+        c_Thread = std::thread(Write, this);
+    }
+    catch (std::exception& e)
+    {
+        Close();
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to start write thread: " + std::string(e.what()));
+    }
+}
+
+SpeechResult<std::unique_ptr<UtteranceHistory>> UtteranceHistory::Create(std::string const& s_FilePath) noexcept
+{
+    // @NOTE: File errors are handled with exceptions internally, the
+    //        history is written on its own thread outside the update
+    try
+    {
+        return std::unique_ptr<UtteranceHistory>(new UtteranceHistory(s_FilePath));
+    }
+    catch (MRH_ModuleException& e)
+    {
+        return SpeechError{ "UtteranceHistory", e.what2() };
+    }
+    catch (std::exception& e)
+    {
+        return SpeechError{ "UtteranceHistory", std::string(e.what()) };
+    }
+}
+
+UtteranceHistory::~UtteranceHistory() noexcept
+{
+    {
+        std::lock_guard<std::mutex> c_Guard(c_PendingMutex);
+        b_Run = false;
+    }
+    
+    c_PendingCondition.notify_one();
+    c_Thread.join();
+    
+    Close();
+}
+
+//*************************************************************************************
+// File
+//*************************************************************************************
+
+void UtteranceHistory::Open()
+{
+    if ((i_FileDescriptor = open(s_FilePath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644)) < 0)
+    {
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to open " + s_FilePath + ": " + std::string(strerror(errno)));
+    }
+    
+    struct stat c_Stat;
+    
+    if (fstat(i_FileDescriptor, &c_Stat) < 0)
+    {
+        Close();
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to read file size: " + std::string(strerror(errno)));
+    }
+    
+    bool b_Valid = false;
+    
+    if ((size_t)c_Stat.st_size >= sizeof(FileHeader))
+    {
+        Map(c_Stat.st_size);
+        
+        FileHeader c_Header;
+        memcpy(&c_Header, p_Map, sizeof(FileHeader));
+        
+        b_Valid = memcmp(c_Header.p_Magic, p_HistoryMagic, sizeof(p_HistoryMagic)) == 0 &&
+                  c_Header.u32_Version == u32_HistoryVersion;
+    }
+    
+    if (b_Valid == false)
+    {
+        // New or unusable log, start over
+        if (ftruncate(i_FileDescriptor, 0) < 0)
+        {
+            Close();
+            throw MRH_ModuleException("UtteranceHistory",
+                                      "Failed to reset file: " + std::string(strerror(errno)));
+        }
+        
+        Map(UTTERANCE_HISTORY_GROW_SIZE);
+        
+        FileHeader c_Header;
+        memcpy(c_Header.p_Magic, p_HistoryMagic, sizeof(p_HistoryMagic));
+        c_Header.u32_Version = u32_HistoryVersion;
+        c_Header.u32_Reserved = 0;
+        
+        memcpy(p_Map, &c_Header, sizeof(FileHeader));
+    }
+    
+    Recover();
+}
+
+void UtteranceHistory::Close() noexcept
+{
+    if (p_Map != NULL)
+    {
+        msync(p_Map, us_MapSize, MS_SYNC);
+        munmap(p_Map, us_MapSize);
+        
+        p_Map = NULL;
+        us_MapSize = 0;
+    }
+    
+    if (i_FileDescriptor >= 0)
+    {
+        close(i_FileDescriptor);
+        i_FileDescriptor = -1;
+    }
+}
+
+void UtteranceHistory::Map(size_t us_Size)
+{
+    if (p_Map != NULL)
+    {
+        munmap(p_Map, us_MapSize);
+        
+        p_Map = NULL;
+        us_MapSize = 0;
+    }
+    
+    struct stat c_Stat;
+    
+    if (fstat(i_FileDescriptor, &c_Stat) < 0 ||
+        ((size_t)c_Stat.st_size < us_Size && ftruncate(i_FileDescriptor, us_Size) < 0))
+    {
+        Close();
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to resize file: " + std::string(strerror(errno)));
+    }
+    
+    void* p_Address = mmap(NULL, us_Size, PROT_READ | PROT_WRITE, MAP_SHARED, i_FileDescriptor, 0);
+    
+    if (p_Address == MAP_FAILED)
+    {
+        Close();
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to map file: " + std::string(strerror(errno)));
+    }
+    
+    p_Map = static_cast<MRH_Uint8*>(p_Address);
+    us_MapSize = us_Size;
+}
+
+void UtteranceHistory::Recover() noexcept
+{
+    us_End = sizeof(FileHeader);
+    u32_IndexHead = 0;
+    u32_IndexCount = 0;
+    
+    // Read until the first incomplete or damaged record, which is
+    // what a crash during a append leaves behind
+    while (us_End + sizeof(RecordHeader) <= us_MapSize)
+    {
+        RecordHeader c_Record;
+        memcpy(&c_Record, p_Map + us_End, sizeof(RecordHeader));
+        
+        if (c_Record.u32_Size == 0 ||
+            c_Record.u32_Size > UTTERANCE_HISTORY_RECORD_MAX ||
+            us_End + sizeof(RecordHeader) + c_Record.u32_Size > us_MapSize ||
+            Checksum(p_Map + us_End + sizeof(RecordHeader), c_Record.u32_Size) != c_Record.u32_Checksum)
+        {
+            break;
+        }
+        
+        p_Index[u32_IndexHead] = us_End;
+        u32_IndexHead = (u32_IndexHead + 1) % UTTERANCE_HISTORY_INDEX_SIZE;
+        
+        if (u32_IndexCount < UTTERANCE_HISTORY_INDEX_SIZE)
+        {
+            ++u32_IndexCount;
+        }
+        
+        us_End += sizeof(RecordHeader) + c_Record.u32_Size;
+    }
+    
+    // Clear the damaged tail so that no stale record follows new ones
+    memset(p_Map + us_End, 0, us_MapSize - us_End);
+}
+
+void UtteranceHistory::Compact()
+{
+    std::string s_TempPath = s_FilePath + ".tmp";
+    int i_TempDescriptor;
+    
+    if ((i_TempDescriptor = open(s_TempPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)) < 0)
+    {
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to open " + s_TempPath + ": " + std::string(strerror(errno)));
+    }
+    
+    // Keep the header and the indexed records, oldest first
+    bool b_Written = write(i_TempDescriptor, p_Map, sizeof(FileHeader)) == sizeof(FileHeader);
+    
+    for (MRH_Uint32 i = u32_IndexCount; i > 0 && b_Written == true; --i)
+    {
+        size_t us_Offset = p_Index[(u32_IndexHead + UTTERANCE_HISTORY_INDEX_SIZE - i) % UTTERANCE_HISTORY_INDEX_SIZE];
+        RecordHeader c_Record;
+        memcpy(&c_Record, p_Map + us_Offset, sizeof(RecordHeader));
+        
+        ssize_t ss_Size = sizeof(RecordHeader) + c_Record.u32_Size;
+        b_Written = write(i_TempDescriptor, p_Map + us_Offset, ss_Size) == ss_Size;
+    }
+    
+    if (b_Written == false || fsync(i_TempDescriptor) < 0)
+    {
+        close(i_TempDescriptor);
+        unlink(s_TempPath.c_str());
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to write " + s_TempPath + ": " + std::string(strerror(errno)));
+    }
+    
+    close(i_TempDescriptor);
+    
+    // Replace in one step, a crash leaves either the old or the new log
+    if (rename(s_TempPath.c_str(), s_FilePath.c_str()) < 0)
+    {
+        unlink(s_TempPath.c_str());
+        throw MRH_ModuleException("UtteranceHistory",
+                                  "Failed to replace " + s_FilePath + ": " + std::string(strerror(errno)));
+    }
+    
+    Close();
+    Open();
+}
+
+//*************************************************************************************
+// Recent
+//*************************************************************************************
+
+void UtteranceHistory::Publish() noexcept
+{
+    try
+    {
+        std::unique_ptr<Recent> p_New(new Recent());
+        p_New->v_Utterance.reserve(u32_IndexCount);
+        
+        for (MRH_Uint32 i = 0; i < u32_IndexCount && p_Map != NULL; ++i)
+        {
+            size_t us_Offset = p_Index[(u32_IndexHead + UTTERANCE_HISTORY_INDEX_SIZE - 1 - i) % UTTERANCE_HISTORY_INDEX_SIZE];
+            RecordHeader c_Record;
+            memcpy(&c_Record, p_Map + us_Offset, sizeof(RecordHeader));
+            
+            p_New->v_Utterance.emplace_back(reinterpret_cast<const char*>(p_Map + us_Offset + sizeof(RecordHeader)), c_Record.u32_Size);
+        }
+        
+        c_Recent.Publish(std::move(p_New));
+    }
+    catch (std::exception& e)
+    {
+        // Keep the last published utterances
+        MRH_ModuleLogger::Singleton().Log("UtteranceHistory", "Failed to publish utterances: " +
+                                                              std::string(e.what()),
+                                          "UtteranceHistory.cpp", __LINE__);
+    }
+}
+
+//*************************************************************************************
+// Add
+//*************************************************************************************
+
+void UtteranceHistory::Add(std::string const& s_Utterance) noexcept
+{
+    if (s_Utterance.size() == 0)
+    {
+        return;
+    }
+    
+    try
+    {
+        std::lock_guard<std::mutex> c_Guard(c_PendingMutex);
+        dq_Pending.emplace_back(s_Utterance);
+    }
+    catch (std::exception& e)
+    {
+        MRH_ModuleLogger::Singleton().Log("UtteranceHistory", "Failed to add utterance: " +
+                                                              std::string(e.what()),
+                                          "UtteranceHistory.cpp", __LINE__);
+        return;
+    }
+    
+    c_PendingCondition.notify_one();
+}
+
+//*************************************************************************************
+// Write
+//*************************************************************************************
+
+void UtteranceHistory::Append(std::string const& s_Utterance)
+{
+    MRH_Uint32 u32_Size = s_Utterance.size() > UTTERANCE_HISTORY_RECORD_MAX ? UTTERANCE_HISTORY_RECORD_MAX : s_Utterance.size();
+    size_t us_Required = sizeof(RecordHeader) + u32_Size;
+    
+    std::lock_guard<std::mutex> c_Guard(c_LogMutex);
+    
+    if (p_Map == NULL)
+    {
+        // Reopen after a failed compaction
+        Open();
+    }
+    
+    if (us_End + us_Required > UTTERANCE_HISTORY_FILE_MAX)
+    {
+        Compact();
+    }
+    
+    if (us_End + us_Required > us_MapSize)
+    {
+        size_t us_Size = us_MapSize + UTTERANCE_HISTORY_GROW_SIZE;
+        
+        if (us_Size > UTTERANCE_HISTORY_FILE_MAX)
+        {
+            us_Size = UTTERANCE_HISTORY_FILE_MAX;
+        }
+        
+        Map(us_Size < us_End + us_Required ? us_End + us_Required : us_Size);
+    }
+    
+    // Write data first, the checksum guards against a partial record
+    RecordHeader c_Record;
+    c_Record.u32_Size = u32_Size;
+    c_Record.u32_Checksum = Checksum(reinterpret_cast<const MRH_Uint8*>(s_Utterance.data()), u32_Size);
+    
+    memcpy(p_Map + us_End + sizeof(RecordHeader), s_Utterance.data(), u32_Size);
+    memcpy(p_Map + us_End, &c_Record, sizeof(RecordHeader));
+    
+    p_Index[u32_IndexHead] = us_End;
+    u32_IndexHead = (u32_IndexHead + 1) % UTTERANCE_HISTORY_INDEX_SIZE;
+    
+    if (u32_IndexCount < UTTERANCE_HISTORY_INDEX_SIZE)
+    {
+        ++u32_IndexCount;
+    }
+    
+    us_End += us_Required;
+    
+    msync(p_Map, us_MapSize, MS_ASYNC);
+    
+    Publish();
+}
+
+void UtteranceHistory::Write(UtteranceHistory* p_Instance) noexcept
+{
+    std::unique_lock<std::mutex> c_Lock(p_Instance->c_PendingMutex);
+    
+    while (p_Instance->b_Run == true || p_Instance->dq_Pending.size() > 0)
+    {
+        if (p_Instance->dq_Pending.size() == 0)
+        {
+            p_Instance->c_PendingCondition.wait(c_Lock);
+            continue;
+        }
+        
+        std::string s_Utterance = std::move(p_Instance->dq_Pending.front());
+        p_Instance->dq_Pending.pop_front();
+        
+        // Don't block adding while writing
+        c_Lock.unlock();
+        
+        try
+        {
+            p_Instance->Append(s_Utterance);
+        }
+        catch (MRH_ModuleException& e)
+        {
+            MRH_ModuleLogger::Singleton().Log("UtteranceHistory", "Failed to write utterance: " +
+                                                                  e.what2(),
+                                              "UtteranceHistory.cpp", __LINE__);
+        }
+        catch (std::exception& e)
+        {
+            MRH_ModuleLogger::Singleton().Log("UtteranceHistory", "Failed to write utterance: " +
+                                                                  std::string(e.what()),
+                                              "UtteranceHistory.cpp", __LINE__);
+        }
+        
+        c_Lock.lock();
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+std::string UtteranceHistory::GetUtterance(MRH_Uint32 u32_Age) noexcept
+{
+    std::string s_Utterance;
+    
+    PublishedValue<Recent>::Reader c_Reader(c_Recent);
+    const Recent* p_Current = c_Reader.Get();
+    
+    if (p_Current != NULL && u32_Age < p_Current->v_Utterance.size())
+    {
+        try
+        {
+            s_Utterance = p_Current->v_Utterance[u32_Age];
+        }
+        catch (...)
+        {}
+    }
+    
+    return s_Utterance;
+}
+
+std::vector<std::string> UtteranceHistory::GetUtterances(MRH_Uint32 u32_Count) noexcept
+{
+    std::vector<std::string> v_Utterance;
+    
+    // @NOTE: Read from one published snapshot, a write in between
+    //        would otherwise shift the ages
+    PublishedValue<Recent>::Reader c_Reader(c_Recent);
+    const Recent* p_Current = c_Reader.Get();
+    
+    if (p_Current == NULL)
+    {
+        return v_Utterance;
+    }
+    else if (u32_Count > p_Current->v_Utterance.size())
+    {
+        u32_Count = p_Current->v_Utterance.size();
+    }
+    
+    try
+    {
+        v_Utterance.reserve(u32_Count);
+        
+        for (MRH_Uint32 i = u32_Count; i > 0; --i)
+        {
+            v_Utterance.emplace_back(p_Current->v_Utterance[i - 1]);
+        }
+    }
+    catch (...)
+    {
+        v_Utterance.clear();
+    }
+    
+    return v_Utterance;
+}
+
+MRH_Uint32 UtteranceHistory::GetUtteranceCount() noexcept
+{
+    PublishedValue<Recent>::Reader c_Reader(c_Recent);
+    const Recent* p_Current = c_Reader.Get();
+    
+    return p_Current != NULL ? p_Current->v_Utterance.size() : 0;
+}
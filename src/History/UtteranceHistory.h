@@ -0,0 +1,250 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef UtteranceHistory_h
+#define UtteranceHistory_h
+
+// C / C++
+#include <string>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+#include "../Module/SpeechResult.h"
+#include "../Module/PublishedValue.h"
+
+// Pre-defined
+#ifndef UTTERANCE_HISTORY_INDEX_SIZE
+    #define UTTERANCE_HISTORY_INDEX_SIZE 16
+#endif
+
+
+class UtteranceHistory
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Open a history.
+     *
+     *  \param s_FilePath The full path to the history log file.
+     *
+     *  \return The opened history.
+     */
+    
+    static SpeechResult<std::unique_ptr<UtteranceHistory>> Create(std::string const& s_FilePath) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~UtteranceHistory() noexcept;
+    
+    //*************************************************************************************
+    // Add
+    //*************************************************************************************
+    
+    /**
+     *  Add a utterance to the history. The utterance is written in the
+     *  background.
+     *
+     *  \param s_Utterance The utterance to add.
+     */
+    
+    void Add(std::string const& s_Utterance) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get a recent utterance. Recent utterances are read without locking,
+     *  only one thread may read at a time.
+     *
+     *  \param u32_Age The age of the utterance, 0 is the most recent one.
+     *
+     *  \return The utterance, empty if none exists for the given age.
+     */
+    
+    std::string GetUtterance(MRH_Uint32 u32_Age) noexcept;
+    
+    /**
+     *  Get the most recent utterances. Recent utterances are read without
+     *  locking, only one thread may read at a time.
+     *
+     *  \param u32_Count The amount of utterances to get.
+     *
+     *  \return The utterances, oldest first. Fewer are returned if less
+     *          are recent.
+     */
+    
+    std::vector<std::string> GetUtterances(MRH_Uint32 u32_Count) noexcept;
+    
+    /**
+     *  Get the amount of recent utterances which can be recalled.
+     *
+     *  \return The recent utterance count.
+     */
+    
+    MRH_Uint32 GetUtteranceCount() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param s_FilePath The full path to the history log file.
+     */
+    
+    UtteranceHistory(std::string const& s_FilePath);
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct FileHeader
+    {
+        char p_Magic[8];
+        MRH_Uint32 u32_Version;
+        MRH_Uint32 u32_Reserved;
+    };
+    
+    struct RecordHeader
+    {
+        MRH_Uint32 u32_Size;
+        MRH_Uint32 u32_Checksum;
+    };
+    
+    struct Recent
+    {
+        // Indexed utterances, most recent first
+        std::vector<std::string> v_Utterance;
+    };
+    
+    //*************************************************************************************
+    // File
+    //*************************************************************************************
+    
+    /**
+     *  Open and map the log file.
+     */
+    
+    void Open();
+    
+    /**
+     *  Close and unmap the log file.
+     */
+    
+    void Close() noexcept;
+    
+    /**
+     *  Map the log file with the given size.
+     *
+     *  \param us_Size The new file size.
+     */
+    
+    void Map(size_t us_Size);
+    
+    /**
+     *  Find the end of the valid log and rebuild the index.
+     */
+    
+    void Recover() noexcept;
+    
+    /**
+     *  Rewrite the log file with only the indexed utterances.
+     */
+    
+    void Compact();
+    
+    //*************************************************************************************
+    // Recent
+    //*************************************************************************************
+    
+    /**
+     *  Publish the indexed utterances for reading. The log has to be locked.
+     */
+    
+    void Publish() noexcept;
+    
+    //*************************************************************************************
+    // Write
+    //*************************************************************************************
+    
+    /**
+     *  Append a utterance to the log.
+     *
+     *  \param s_Utterance The utterance to append.
+     */
+    
+    void Append(std::string const& s_Utterance);
+    
+    /**
+     *  Write added utterances to the log.
+     *
+     *  \param p_Instance The history to write for.
+     */
+    
+    static void Write(UtteranceHistory* p_Instance) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::string s_FilePath;
+    
+    // Log file
+    int i_FileDescriptor;
+    MRH_Uint8* p_Map;
+    size_t us_MapSize;
+    size_t us_End;
+    
+    // Recent records, offsets into the log
+    size_t p_Index[UTTERANCE_HISTORY_INDEX_SIZE];
+    MRH_Uint32 u32_IndexHead;
+    MRH_Uint32 u32_IndexCount;
+    std::mutex c_LogMutex;
+    
+    // Published recent utterances, read without locking
+    PublishedValue<Recent> c_Recent;
+    
+    // Background writing
+    std::deque<std::string> dq_Pending;
+    std::mutex c_PendingMutex;
+    std::condition_variable c_PendingCondition;
+    bool b_Run;
+    std::thread c_Thread;
+    
+protected:
+    
+};
+
+#endif /* UtteranceHistory_h */
@@ -18,6 +18,7 @@
 #include <cstdio>
 #include <string>
 #include <iostream>
+#include <chrono>
 
 // External
 #include <libmrh/MRH_AppLoop.h>
@@ -25,9 +26,21 @@
 
 // Project
 #include "./Module/MirrorSpeech.h"
+#include "./AppData.h"
+#include "./Module/EventRoute.h"
+#include "./EventLanes.h"
+#include "./Module/ModuleAccounting.h"
+#ifdef MIRROR_SPEECH_SOAK
+    #include "./Soak/SoakService.h"
+    #include "./Soak/SoakMonitor.h"
+#endif
 #include "./Revision.h"
 
 // Pre-defined
+#ifndef MIRROR_SPEECH_SOAK_FLOOD
+    #define MIRROR_SPEECH_SOAK_FLOOD 0
+#endif
+
 namespace
 {
     libmrhab* p_Context = NULL;
@@ -55,10 +68,36 @@ extern "C"
                                  ")",
                      "Main.cpp", __LINE__);
     
+        std::chrono::steady_clock::time_point c_InitStart = std::chrono::steady_clock::now();
+        
+        // Persistent data is optional, the app works without
+        SpeechResult<std::string> c_DataDirectory = AppData::GetDirectory();
+        std::string s_DataDirectory;
+        
+        if (c_DataDirectory.GetSucceeded() == true)
+        {
+            s_DataDirectory = c_DataDirectory.GetValue();
+        }
+        else
+        {
+            c_Logger.Log("MRH_Init", "App data unavailable: " +
+                                     c_DataDirectory.GetError().s_Message,
+                         "Main.cpp", __LINE__);
+        }
+        
+#ifdef MIRROR_SPEECH_SOAK
+        SoakMonitor::Singleton().Open(s_DataDirectory);
+#endif
+        
         try
         {
-            p_Context = new libmrhab(std::make_unique<MirrorSpeech>(),
+            p_Context = new libmrhab(std::make_unique<MirrorSpeech>(s_DataDirectory),
                                      i_CallbackThreadCount);
+            
+            c_Logger.Log("MRH_Init", "Initialized in " +
+                                     std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - c_InitStart).count()) +
+                                     " us",
+                         "Main.cpp", __LINE__);
             return 0;
         }
         catch (MRH_ABException& e)
@@ -83,14 +122,21 @@ extern "C"
 
     void MRH_ReceiveEvent(const MRH_Event* p_Event)
     {
+        // Drop events the current module can't use before creating a job
+        if (EventRoute::Singleton().RouteEvent(p_Event->u32_Type) == false)
+        {
+            return;
+        }
+        
+        // Jobs are added on the next update, by event priority
         try
         {
-            p_Context->AddJob(p_Event);
+            EventLanes::Singleton().Add(p_Event);
         }
-        catch (MRH_ABException& e)
+        catch (std::exception& e)
         {
-            MRH_ModuleLogger::Singleton().Log("MRH_ReceiveEvent", "Failed to add event job: " +
-                                                                  e.what2(),
+            MRH_ModuleLogger::Singleton().Log("MRH_ReceiveEvent", "Failed to add event: " +
+                                                                  std::string(e.what()),
                                               "Main.cpp", __LINE__);
         }
     }
@@ -105,8 +151,32 @@ extern "C"
     
         if (b_UpdateModules == true)
         {
+#ifdef MIRROR_SPEECH_SOAK
+            // Events of other services arrive between the responses
+            for (MRH_Uint32 i = 0; i < MIRROR_SPEECH_SOAK_FLOOD; ++i)
+            {
+                MRH_ReceiveEvent(SoakService::Singleton().GetFlood());
+            }
+            
+            // Answer as the speech service would, one response per update
+            MRH_Event* p_Response = SoakService::Singleton().GetResponse();
+            
+            if (p_Response != NULL)
+            {
+                MRH_ReceiveEvent(p_Response);
+                MRH_EVD_DestroyEvent(p_Response);
+            }
+#endif
+            {
+                ModuleAccounting::Scope c_Scope(ModuleAccounting::EVENT_LANES);
+                EventLanes::Singleton().Dispatch(p_Context);
+            }
+            
             try
             {
+                // Module time is accounted on its own, only the
+                // library overhead remains here
+                ModuleAccounting::Scope c_Scope(ModuleAccounting::APP_BASE);
                 LIBMRHAB_UPDATE_RESULT b_Result = p_Context->Update();
             
                 if (b_Result == LIBMRHAB_UPDATE_CLOSE_APP)
@@ -129,7 +199,15 @@ extern "C"
         }
     
         MRH_Event* p_Event = MRH_EventStorage::Singleton().GetEvent(true);
-    
+        
+#ifdef MIRROR_SPEECH_SOAK
+        if (p_Event != NULL)
+        {
+            SoakService::Singleton().Send(p_Event);
+            p_Event = NULL;
+        }
+#endif
+        
         if (p_Event == NULL)
         {
             b_UpdateModules = true;
@@ -149,12 +227,54 @@ extern "C"
 
     void MRH_Exit(void)
     {
+        EventRoute& c_EventRoute = EventRoute::Singleton();
+        MRH_ModuleLogger::Singleton().Log("MRH_Exit", "Rejected " +
+                                                      std::to_string(c_EventRoute.GetRejectedCount()) +
+                                                      " of " +
+                                                      std::to_string(c_EventRoute.GetReceivedCount()) +
+                                                      " received events",
+                                          "Main.cpp", __LINE__);
+        
+        EventLanes& c_EventLanes = EventLanes::Singleton();
+        
+        for (int i = 0; i < EventLanes::LANE_COUNT; ++i)
+        {
+            EventLanes::Lane e_Lane = static_cast<EventLanes::Lane>(i);
+            MRH_ModuleLogger::Singleton().Log("MRH_Exit", "Event lane " +
+                                                          std::string(EventLanes::GetLaneName(e_Lane)) +
+                                                          ": " +
+                                                          std::to_string(c_EventLanes.GetDispatchedCount(e_Lane)) +
+                                                          " dispatched, " +
+                                                          std::to_string(c_EventLanes.GetDroppedCount(e_Lane)) +
+                                                          " dropped, delay mean " +
+                                                          std::to_string(c_EventLanes.GetMeanDelay(e_Lane)) +
+                                                          " us, max " +
+                                                          std::to_string(c_EventLanes.GetMaxDelay(e_Lane)) +
+                                                          " us",
+                                              "Main.cpp", __LINE__);
+        }
+        
+        ModuleAccounting::Singleton().Log();
+        
         if (p_Context != NULL)
         {
             delete p_Context;
         }
     }
 
+#ifdef MIRROR_SPEECH_SOAK
+    //*************************************************************************************
+    // Soak
+    //*************************************************************************************
+
+    const char* MRH_SoakDrift(void)
+    {
+        // @NOTE: Not part of the platform app loop, the soak runner
+        //        checks this after exit to fail the run on drift
+        return SoakMonitor::Singleton().GetDrift();
+    }
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,109 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+
+// External
+
+// Project
+#include "./EventRoute.h"
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+EventRoute::EventRoute() noexcept : u64_Received(0),
+                                    u64_Rejected(0)
+{
+    // Nothing is routed until a module was set
+    for (MRH_Uint32 i = 0; i < u32_WordCount; ++i)
+    {
+        p_Route[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+EventRoute::~EventRoute() noexcept
+{}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+EventRoute& EventRoute::Singleton() noexcept
+{
+    static EventRoute c_EventRoute;
+    return c_EventRoute;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void EventRoute::Update(bool (*p_CanRoute)(MRH_Uint32 u32_Type)) noexcept
+{
+    for (MRH_Uint32 i = 0; i < u32_WordCount; ++i)
+    {
+        MRH_Uint64 u64_Word = 0;
+        
+        for (MRH_Uint32 j = 0; j < u32_WordBits; ++j)
+        {
+            if (p_CanRoute((i * u32_WordBits) + j) == true)
+            {
+                u64_Word |= ((MRH_Uint64)1 << j);
+            }
+        }
+        
+        p_Route[i].store(u64_Word, std::memory_order_release);
+    }
+}
+
+bool EventRoute::RouteEvent(MRH_Uint32 u32_Type) noexcept
+{
+    u64_Received.fetch_add(1, std::memory_order_relaxed);
+    
+    // @NOTE: Modules only handle platform event types, anything
+    //        above them would be queued and dropped by libmrhab
+    if (u32_Type >= EVENT_ROUTE_TYPE_COUNT)
+    {
+        u64_Rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    MRH_Uint64 u64_Word = p_Route[u32_Type / u32_WordBits].load(std::memory_order_acquire);
+    
+    if ((u64_Word & ((MRH_Uint64)1 << (u32_Type % u32_WordBits))) == 0)
+    {
+        u64_Rejected.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    
+    return true;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+MRH_Uint64 EventRoute::GetReceivedCount() const noexcept
+{
+    return u64_Received.load(std::memory_order_relaxed);
+}
+
+MRH_Uint64 EventRoute::GetRejectedCount() const noexcept
+{
+    return u64_Rejected.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,129 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef EventRoute_h
+#define EventRoute_h
+
+// C / C++
+#include <atomic>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+
+// Pre-defined
+#ifndef EVENT_ROUTE_TYPE_COUNT
+    #define EVENT_ROUTE_TYPE_COUNT (MRH_EVENT_TYPE_MAX + 1)
+#endif
+
+
+class EventRoute
+{
+public:
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static EventRoute& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Rebuild the route for the events usable by the modules.
+     *
+     *  \param p_CanRoute Checks if a event type can be used.
+     */
+    
+    void Update(bool (*p_CanRoute)(MRH_Uint32 u32_Type)) noexcept;
+    
+    /**
+     *  Check if a received event should be routed to the modules. Types
+     *  above the platform event types are always dropped.
+     *
+     *  \param u32_Type The type of the received event.
+     *
+     *  \return true if the event should be routed, false if it can be dropped.
+     */
+    
+    bool RouteEvent(MRH_Uint32 u32_Type) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the amount of events checked.
+     *
+     *  \return The checked event count.
+     */
+    
+    MRH_Uint64 GetReceivedCount() const noexcept;
+    
+    /**
+     *  Get the amount of events dropped.
+     *
+     *  \return The dropped event count.
+     */
+    
+    MRH_Uint64 GetRejectedCount() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    EventRoute() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~EventRoute() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    static constexpr MRH_Uint32 u32_WordBits = 64;
+    static constexpr MRH_Uint32 u32_WordCount = (EVENT_ROUTE_TYPE_COUNT + u32_WordBits - 1) / u32_WordBits;
+    
+    // @NOTE: Events are received on the platform thread, the route
+    //        is rebuilt on the module update thread
+    std::atomic<MRH_Uint64> p_Route[u32_WordCount];
+    
+    std::atomic<MRH_Uint64> u64_Received;
+    std::atomic<MRH_Uint64> u64_Rejected;
+    
+protected:
+    
+};
+
+#endif /* EventRoute_h */
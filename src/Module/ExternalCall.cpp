@@ -0,0 +1,119 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <fstream>
+
+// External
+#include <libmrhvt/Output/MRH_OutputGenerator.h>
+#include <libmrhvt/String/MRH_LocalisedPath.h>
+
+// Project
+#include "./ExternalCall.h"
+#include "./SpeechText.h"
+
+// @NOTE: The libraries used here report errors with exceptions. This is
+//        the only module file which has to be built with exceptions!
+
+
+//*************************************************************************************
+// Event
+//*************************************************************************************
+
+SpeechResult<void> ExternalCall::AddEvent(MRH_Event* p_Event) noexcept
+{
+    try
+    {
+        MRH_EventStorage::Singleton().Add(p_Event);
+        return SpeechResult<void>();
+    }
+    catch (MRH_ABException& e)
+    {
+        MRH_EVD_DestroyEvent(p_Event);
+        return SpeechError{ "ExternalCall", "Failed to add event: " + e.what2() };
+    }
+}
+
+//*************************************************************************************
+// Output
+//*************************************************************************************
+
+SpeechResult<std::string> ExternalCall::GenerateOutput(std::string const& s_Directory, std::string const& s_File) noexcept
+{
+    try
+    {
+        return MRH_OutputGenerator(MRH_LocalisedPath::GetPath(s_Directory, s_File)).Generate();
+    }
+    catch (MRH_VTException& e)
+    {
+        return SpeechError{ "ExternalCall", "Failed to generate output: " + e.what2() };
+    }
+    catch (std::exception& e)
+    {
+        return SpeechError{ "ExternalCall", "Failed to generate output: " + std::string(e.what()) };
+    }
+}
+
+//*************************************************************************************
+// Input
+//*************************************************************************************
+
+SpeechResult<std::vector<std::string>> ExternalCall::ReadPhrases(std::string const& s_Directory, std::string const& s_File) noexcept
+{
+    try
+    {
+        std::string s_FilePath = MRH_LocalisedPath::GetPath(s_Directory, s_File);
+        std::ifstream f_File(s_FilePath);
+        
+        if (f_File.is_open() == false)
+        {
+            return SpeechError{ "ExternalCall", "Failed to open " + s_FilePath };
+        }
+        
+        std::vector<std::string> v_Phrase;
+        std::string s_Line;
+        
+        while (std::getline(f_File, s_Line))
+        {
+            if (s_Line.size() == 0 || s_Line[0] == '#')
+            {
+                continue;
+            }
+            
+            // Phrases are compared against normalized input
+            std::string s_Phrase(s_Line.size(), '\0');
+            size_t us_Written;
+            
+            if (SpeechText::Normalize(s_Line.data(), s_Line.size(), s_Phrase.data(), us_Written, true) == false || us_Written == 0)
+            {
+                continue;
+            }
+            
+            s_Phrase.resize(us_Written);
+            v_Phrase.emplace_back(std::move(s_Phrase));
+        }
+        
+        return v_Phrase;
+    }
+    catch (MRH_VTException& e)
+    {
+        return SpeechError{ "ExternalCall", "Failed to read phrases: " + e.what2() };
+    }
+    catch (std::exception& e)
+    {
+        return SpeechError{ "ExternalCall", "Failed to read phrases: " + std::string(e.what()) };
+    }
+}
@@ -0,0 +1,97 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef ExternalCall_h
+#define ExternalCall_h
+
+// C / C++
+#include <string>
+#include <vector>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+#include "./SpeechResult.h"
+
+
+class ExternalCall
+{
+public:
+    
+    //*************************************************************************************
+    // Event
+    //*************************************************************************************
+    
+    /**
+     *  Add a event to the event storage. The event is destroyed on failure.
+     *
+     *  \param p_Event The event to add.
+     *
+     *  \return The call result.
+     */
+    
+    static SpeechResult<void> AddEvent(MRH_Event* p_Event) noexcept;
+    
+    //*************************************************************************************
+    // Output
+    //*************************************************************************************
+    
+    /**
+     *  Generate a output string from the localised output file.
+     *
+     *  \param s_Directory The output directory.
+     *  \param s_File The output file name.
+     *
+     *  \return The call result.
+     */
+    
+    static SpeechResult<std::string> GenerateOutput(std::string const& s_Directory, std::string const& s_File) noexcept;
+    
+    //*************************************************************************************
+    // Input
+    //*************************************************************************************
+    
+    /**
+     *  Read the phrases of a localised input file. Each line is a phrase,
+     *  normalized with folded case. Empty lines and lines starting with #
+     *  are skipped.
+     *
+     *  \param s_Directory The input directory.
+     *  \param s_File The input file name.
+     *
+     *  \return The call result.
+     */
+    
+    static SpeechResult<std::vector<std::string>> ReadPhrases(std::string const& s_Directory, std::string const& s_File) noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    ExternalCall() noexcept = delete;
+    
+protected:
+    
+};
+
+#endif /* ExternalCall_h */
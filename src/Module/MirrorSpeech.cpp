@@ -15,13 +15,20 @@
  */
 
 // C / C++
+#include <cstdlib>
 
 // External
-#include <libmrhvt/Output/MRH_OutputGenerator.h>
-#include <libmrhvt/String/MRH_LocalisedPath.h>
 
 // Project
 #include "./MirrorSpeech.h"
+#include "./EventRoute.h"
+#include "./ExternalCall.h"
+#include "./ModuleAccounting.h"
+#include "./SpeechText.h"
+#include "../Session/SessionSnapshot.h"
+#ifdef MIRROR_SPEECH_SOAK
+    #include "../Soak/SoakMonitor.h"
+#endif
 #include "./SpeechInput.h"
 #include "./SpeechOutput.h"
 
@@ -32,83 +39,363 @@
 #ifndef MIRROR_SPEECH_OUTPUT_FILE
     #define MIRROR_SPEECH_OUTPUT_FILE "WhatInput.mrhog"
 #endif
+#ifndef MIRROR_SPEECH_INPUT_DIR
+    #define MIRROR_SPEECH_INPUT_DIR "Input"
+#endif
+#ifndef MIRROR_SPEECH_RECALL_FILE
+    #define MIRROR_SPEECH_RECALL_FILE "Recall.txt"
+#endif
+#ifndef MIRROR_SPEECH_HISTORY_FILE
+    #define MIRROR_SPEECH_HISTORY_FILE "UtteranceHistory.mrhuh"
+#endif
+#ifndef MIRROR_SPEECH_SESSION_FILE
+    #define MIRROR_SPEECH_SESSION_FILE "Session.mrhss"
+#endif
+#ifndef MIRROR_SPEECH_CYCLE_COUNT
+    #define MIRROR_SPEECH_CYCLE_COUNT 1
+#endif
 
 
 //*************************************************************************************
 // Constructor / Destructor
 //*************************************************************************************
 
-MirrorSpeech::MirrorSpeech() noexcept : MRH_Module("MirrorSpeech"),
-                                        e_State(START),
-                                        s_Input("")
-{}
+MirrorSpeech::MirrorSpeech(std::string const& s_DataDirectory) : MRH_Module("MirrorSpeech"),
+                                                                 e_State(START),
+                                                                 s_Output(""),
+                                                                 s_Input(""),
+                                                                 b_Recalled(false),
+                                                                 c_Task(Run()),
+                                                                 u32_Cycle(0),
+                                                                 s_SessionPath("")
+{
+    // @NOTE: Events for the next operation can be received in the same
+    //        update as the event which completes the current one, route
+    //        everything the flow awaits
+    EventRoute::Singleton().Update(CanAwaitEvent);
+    
+    if (s_DataDirectory.size() > 0)
+    {
+        s_SessionPath = s_DataDirectory + "/" MIRROR_SPEECH_SESSION_FILE;
+    }
+    
+    // Continue a session interrupted by the last app stop
+    SpeechResult<SessionSnapshot> c_Snapshot = SessionSnapshot::Load(s_SessionPath);
+    
+    if (c_Snapshot.GetSucceeded() == true)
+    {
+        SessionSnapshot& c_Session = c_Snapshot.GetValue();
+        
+        switch (c_Session.GetState())
+        {
+            case ASK_OUTPUT:
+            case LISTEN_INPUT:
+                // Ask again with the same output, no new generation
+                s_Output = c_Session.GetOutput();
+                break;
+                
+            case REPEAT_OUTPUT:
+                e_State = REPEAT_OUTPUT;
+                s_Input = c_Session.GetInput();
+                b_Recalled = c_Session.GetRecalled();
+                break;
+                
+            default:
+                break;
+        }
+        
+        MRH_ModuleLogger::Singleton().Log("MirrorSpeech", "Restored session (State: " +
+                                                          std::to_string(c_Session.GetState()) +
+                                                          ")",
+                                          "MirrorSpeech.cpp", __LINE__);
+    }
+    
+
+    // The history is optional, mirroring works without it
+    SpeechResult<std::unique_ptr<UtteranceHistory>> c_History = SpeechError{ "MirrorSpeech", "No app data directory" };
+    
+    if (s_DataDirectory.size() > 0)
+    {
+        c_History = UtteranceHistory::Create(s_DataDirectory + "/" MIRROR_SPEECH_HISTORY_FILE);
+    }
+    
+    if (c_History.GetSucceeded() == true)
+    {
+        p_History = std::move(c_History.GetValue());
+        
+        // Recalling needs the history
+        SpeechResult<std::vector<std::string>> c_Recall = ExternalCall::ReadPhrases(MIRROR_SPEECH_INPUT_DIR,
+                                                                                    MIRROR_SPEECH_RECALL_FILE);
+        
+        if (c_Recall.GetSucceeded() == true)
+        {
+            // Phrases ending with |N recall the last N utterances
+            for (auto& Phrase : c_Recall.GetValue())
+            {
+                size_t us_Split = Phrase.rfind('|');
+                MRH_Uint32 u32_Count = 1;
+                
+                if (us_Split != std::string::npos)
+                {
+                    u32_Count = std::strtoul(Phrase.c_str() + us_Split + 1, NULL, 10);
+                    Phrase.resize(us_Split > 0 && Phrase[us_Split - 1] == ' ' ? us_Split - 1 : us_Split);
+                }
+                
+                if (u32_Count == 0 || u32_Count > UTTERANCE_HISTORY_INDEX_SIZE || Phrase.size() == 0)
+                {
+                    MRH_ModuleLogger::Singleton().Log("MirrorSpeech", "Invalid recall phrase: " +
+                                                                      Phrase,
+                                                      "MirrorSpeech.cpp", __LINE__);
+                    continue;
+                }
+                
+                v_Recall.emplace_back(Recall{ std::move(Phrase), u32_Count });
+            }
+        }
+        else
+        {
+            MRH_ModuleLogger::Singleton().Log("MirrorSpeech", "Recall unavailable: " +
+                                                              c_Recall.GetError().s_Message,
+                                              "MirrorSpeech.cpp", __LINE__);
+        }
+    }
+    else
+    {
+        MRH_ModuleLogger::Singleton().Log("MirrorSpeech", "Utterance history unavailable: " +
+                                                          c_History.GetError().s_Message,
+                                          "MirrorSpeech.cpp", __LINE__);
+    }
+    
+    // Prompts are read from file each time without the cache
+    SpeechResult<std::unique_ptr<PromptCache>> c_Prompts = PromptCache::Create(MIRROR_SPEECH_OUTPUT_DIR,
+                                                                               MIRROR_SPEECH_OUTPUT_FILE);
+    
+    if (c_Prompts.GetSucceeded() == true)
+    {
+        p_Prompts = std::move(c_Prompts.GetValue());
+    }
+    else
+    {
+        MRH_ModuleLogger::Singleton().Log("MirrorSpeech", "Prompt cache unavailable: " +
+                                                          c_Prompts.GetError().s_Message,
+                                          "MirrorSpeech.cpp", __LINE__);
+    }
+}
 
 MirrorSpeech::~MirrorSpeech() noexcept
-{}
+{
+    // Only unfinished sessions can be continued
+    if (s_SessionPath.size() == 0)
+    {
+        return;
+    }
+    
+    switch (e_State)
+    {
+        case ASK_OUTPUT:
+        case LISTEN_INPUT:
+        case REPEAT_OUTPUT:
+            break;
+            
+        default:
+            return;
+    }
+    
+    SpeechResult<void> c_Saved = SessionSnapshot(e_State, s_Output, s_Input, b_Recalled).Save(s_SessionPath);
+    
+    if (c_Saved.GetSucceeded() == false)
+    {
+        MRH_ModuleLogger::Singleton().Log("MirrorSpeech", "Failed to save session: " +
+                                                          c_Saved.GetError().s_Message,
+                                          "MirrorSpeech.cpp", __LINE__);
+    }
+}
 
 //*************************************************************************************
 // Update
 //*************************************************************************************
 
 void MirrorSpeech::HandleEvent(const MRH_Event* p_Event) noexcept
-{}
+{
+    ModuleAccounting::Scope c_Scope(ModuleAccounting::MIRROR_SPEECH);
+    
+    c_Task.HandleEvent(p_Event);
+}
 
 MRH_Module::Result MirrorSpeech::Update()
 {
-    switch (e_State)
+    ModuleAccounting::Scope c_Scope(ModuleAccounting::MIRROR_SPEECH);
+    
+    // @NOTE: Events resume the flow directly, updates only start it
+    //        and check the timeout of the current operation
+    if (c_Task.Update() == false && c_Task.GetFinished() == false)
     {
-        case START:
-            e_State = ASK_OUTPUT;
-            return MRH_Module::FINISHED_APPEND;
-            
-        case ASK_OUTPUT:
-            e_State = LISTEN_INPUT;
-            return MRH_Module::FINISHED_APPEND;
-            
-        case LISTEN_INPUT:
-            if (s_Input.size() == 0)
+        // Woken up without anything to do
+        c_Scope.SetNoProgress();
+    }
+    
+    if (c_Task.GetFinished() == true)
+    {
+        // Soak builds run the flow many times in a row
+        if (++u32_Cycle < MIRROR_SPEECH_CYCLE_COUNT)
+        {
+#ifdef MIRROR_SPEECH_SOAK
+            // @NOTE: Failed cycles are measured like the others, a
+            //        failure only closes the app outside of soak builds
+            if (SoakMonitor::Singleton().AddCycle() == false)
             {
                 return MRH_Module::FINISHED_POP;
             }
+#endif
+            e_State = START;
+            s_Output = "";
+            s_Input = "";
+            b_Recalled = false;
+            c_Task = Run();
             
-            e_State = REPEAT_OUTPUT;
-            return MRH_Module::FINISHED_APPEND;
-            
-        case REPEAT_OUTPUT:
-            e_State = CLOSE_APP;
-            return MRH_Module::FINISHED_APPEND;
-            
-        default:
-            return MRH_Module::FINISHED_POP;
+            return MRH_Module::IN_PROGRESS;
+        }
+        
+        return MRH_Module::FINISHED_POP;
     }
+    
+    return MRH_Module::IN_PROGRESS;
 }
 
 std::shared_ptr<MRH_Module> MirrorSpeech::NextModule()
 {
-    switch (e_State)
+    // @NOTE: Update() never switches modules, this is never requested!
+    return nullptr;
+}
+
+//*************************************************************************************
+// Flow
+//*************************************************************************************
+
+SpeechTask MirrorSpeech::Run()
+{
+    SpeechResult<void> c_Said;
+    
+    // A restored session might only need to repeat the input
+    if (e_State != REPEAT_OUTPUT)
     {
-        case ASK_OUTPUT:
-            try
-            {
-                return std::make_shared<SpeechOutput>(MRH_OutputGenerator(MRH_LocalisedPath::GetPath(MIRROR_SPEECH_OUTPUT_DIR, 
-                                                                                                     MIRROR_SPEECH_OUTPUT_FILE)).Generate());
-            }
-            catch (MRH_VTException& e)
+        e_State = ASK_OUTPUT;
+        
+        if (s_Output.size() == 0)
+        {
+            SpeechResult<std::string> c_Output = p_Prompts ? p_Prompts->GenerateOutput() :
+                                                             ExternalCall::GenerateOutput(MIRROR_SPEECH_OUTPUT_DIR,
+                                                                                          MIRROR_SPEECH_OUTPUT_FILE);
+            
+            if (c_Output.GetSucceeded() == false)
             {
-                throw MRH_ModuleException("MirrorSpeech",
-                                          "Failed to generate output: " + e.what2());
+                Fail(c_Output.GetError());
+                co_return;
             }
             
-        case LISTEN_INPUT:
-            return std::make_shared<SpeechInput>(s_Input);
-            
-        case REPEAT_OUTPUT:
-            return std::make_shared<SpeechOutput>(s_Input);
+            s_Output = std::move(c_Output.GetValue());
+        }
+        
+        c_Said = co_await SpeechOutput(s_Output);
+        
+        if (c_Said.GetSucceeded() == false)
+        {
+            Fail(c_Said.GetError());
+            co_return;
+        }
+        
+        e_State = LISTEN_INPUT;
+        s_Input = co_await SpeechInput();
+        
+        if (s_Input.size() == 0)
+        {
+            e_State = CLOSE_APP;
+            co_return;
+        }
+        
+        // Repeat the last mirrored utterances instead if asked for
+        MRH_Uint32 u32_Recall = GetRecallCount(s_Input);
+        
+        if (u32_Recall > 0)
+        {
+            std::vector<std::string> v_Recalled = p_History->GetUtterances(u32_Recall);
             
-        default:
-            throw MRH_ModuleException("MirrorSpeech",
-                                      "No module to switch to!");
+            if (v_Recalled.size() > 0)
+            {
+                s_Input = std::move(v_Recalled[0]);
+                
+                for (size_t i = 1; i < v_Recalled.size(); ++i)
+                {
+                    s_Input += ". " + v_Recalled[i];
+                }
+                
+                b_Recalled = true;
+            }
+        }
+    }
+    
+    e_State = REPEAT_OUTPUT;
+    c_Said = co_await SpeechOutput(s_Input);
+    
+    if (c_Said.GetSucceeded() == false)
+    {
+        Fail(c_Said.GetError());
+        co_return;
+    }
+    
+    // Recalled utterances are in the history already
+    if (p_History && b_Recalled == false)
+    {
+        p_History->Add(s_Input);
     }
+    
+    e_State = CLOSE_APP;
+}
+
+void MirrorSpeech::Fail(SpeechError const& c_Error) noexcept
+{
+    {
+        ModuleAccounting::Scope c_LogScope(ModuleAccounting::LOGGER);
+        MRH_ModuleLogger::Singleton().Log(c_Error.s_Source, "Mirror speech failed: " +
+                                                            c_Error.s_Message,
+                                          "MirrorSpeech.cpp", __LINE__);
+    }
+    
+    e_State = CLOSE_APP;
+}
+
+MRH_Uint32 MirrorSpeech::GetRecallCount(std::string const& s_Input) noexcept
+{
+    if (v_Recall.size() == 0)
+    {
+        return 0;
+    }
+    
+    // Input is normalized already, only the case differs
+    std::string s_Folded(s_Input.size(), '\0');
+    size_t us_Written;
+    
+    if (SpeechText::Normalize(s_Input.data(), s_Input.size(), s_Folded.data(), us_Written, true) == false)
+    {
+        return 0;
+    }
+    
+    s_Folded.resize(us_Written);
+    
+    for (auto const& Phrase : v_Recall)
+    {
+        if (Phrase.s_Phrase == s_Folded)
+        {
+            return Phrase.u32_Count;
+        }
+    }
+    
+    return 0;
+}
+
+bool MirrorSpeech::CanAwaitEvent(MRH_Uint32 u32_Type) noexcept
+{
+    return SpeechOutput::CanAwaitEvent(u32_Type) || SpeechInput::CanAwaitEvent(u32_Type);
 }
 
 //*************************************************************************************
@@ -117,5 +404,5 @@ std::shared_ptr<MRH_Module> MirrorSpeech::NextModule()
 
 bool MirrorSpeech::CanHandleEvent(MRH_Uint32 u32_Type) noexcept
 {
-    return false;
+    return c_Task.CanHandleEvent(u32_Type);
 }
@@ -18,11 +18,17 @@
 #define MirrorSpeech_h
 
 // C / C++
+#include <memory>
+#include <vector>
 
 // External
 #include <libmrhab/Module/MRH_Module.h>
 
 // Project
+#include "./SpeechTask.h"
+#include "./SpeechResult.h"
+#include "../History/UtteranceHistory.h"
+#include "../Prompt/PromptCache.h"
 
 
 class MirrorSpeech : public MRH_Module
@@ -35,9 +41,12 @@ public:
     
     /**
      *  Default constructor.
+     *
+     *  \param s_DataDirectory The full path to the app data directory, empty
+     *                         to run without persistent data.
      */
     
-    MirrorSpeech() noexcept;
+    MirrorSpeech(std::string const& s_DataDirectory);
     
     /**
      *  Default destructor.
@@ -106,15 +115,74 @@ private:
         STATE_COUNT = STATE_MAX + 1
     };
     
+    struct Recall
+    {
+        std::string s_Phrase;
+        MRH_Uint32 u32_Count;
+    };
+    
+    //*************************************************************************************
+    // Flow
+    //*************************************************************************************
+    
+    /**
+     *  Run the mirror speech flow.
+     *
+     *  \return The flow task.
+     */
+    
+    SpeechTask Run();
+    
+    /**
+     *  Stop the flow after a error.
+     *
+     *  \param c_Error The error which occured.
+     */
+    
+    void Fail(SpeechError const& c_Error) noexcept;
+    
+    /**
+     *  Get the amount of utterances a input asks to recall.
+     *
+     *  \param s_Input The normalized input.
+     *
+     *  \return The amount of utterances to recall, 0 if the input is not
+     *          a recall phrase.
+     */
+    
+    MRH_Uint32 GetRecallCount(std::string const& s_Input) noexcept;
+    
+    /**
+     *  Check if any operation of the flow can handle a event.
+     *
+     *  \param u32_Type The type of the event to handle.
+     *
+     *  \return true if the event can be used, false if not.
+     */
+    
+    static bool CanAwaitEvent(MRH_Uint32 u32_Type) noexcept;
+    
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
     // Application state
     State e_State;
-
-    // Module information
+    std::string s_Output;
     std::string s_Input;
+    bool b_Recalled;
+    SpeechTask c_Task;
+    MRH_Uint32 u32_Cycle;
+    
+    // Persistent data
+    std::string s_SessionPath;
+    
+    // Mirrored utterances
+    std::unique_ptr<UtteranceHistory> p_History;
+    std::vector<Recall> v_Recall;
+    
+    // Parsed output prompts
+    std::unique_ptr<PromptCache> p_Prompts;
     
 protected:
 
@@ -0,0 +1,225 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <string>
+
+// External
+
+// Project
+#include "./ModuleAccounting.h"
+
+// Pre-defined
+#ifndef MODULE_ACCOUNTING_CALIBRATION_COUNT
+    #define MODULE_ACCOUNTING_CALIBRATION_COUNT 1000
+#endif
+#ifndef MODULE_ACCOUNTING_CPU_INTERVAL
+    #define MODULE_ACCOUNTING_CPU_INTERVAL 16
+#endif
+
+#ifdef MODULE_ACCOUNTING
+namespace
+{
+    const char* p_AccountName[ModuleAccounting::ACCOUNT_COUNT] =
+    {
+        "libmrhab",
+        "EventLanes",
+        "MirrorSpeech",
+        "SpeechInput",
+        "SpeechOutput",
+        "Logger"
+    };
+    
+    thread_local ModuleAccounting::Scope* p_CurrentScope = NULL;
+    thread_local MRH_Uint32 u32_SampleState = 2463534242;
+    
+    bool GetSampled() noexcept
+    {
+        // Xorshift, a fixed interval would follow the update pattern
+        u32_SampleState ^= u32_SampleState << 13;
+        u32_SampleState ^= u32_SampleState >> 17;
+        u32_SampleState ^= u32_SampleState << 5;
+        
+        return (u32_SampleState % MODULE_ACCOUNTING_CPU_INTERVAL) == 0;
+    }
+    
+    MRH_Uint64 GetElapsed(struct timespec const& c_Start, struct timespec const& c_End) noexcept
+    {
+        return ((MRH_Uint64)(c_End.tv_sec - c_Start.tv_sec) * 1000000000) + c_End.tv_nsec - c_Start.tv_nsec;
+    }
+}
+#endif
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+ModuleAccounting::ModuleAccounting() noexcept
+{
+    for (size_t i = 0; i < ACCOUNT_COUNT; ++i)
+    {
+        p_Total[i] = { 0, 0, 0, 0, 0 };
+    }
+}
+
+ModuleAccounting::~ModuleAccounting() noexcept
+{}
+
+#ifdef MODULE_ACCOUNTING
+ModuleAccounting::Scope::Scope(Account e_Account) noexcept : e_Account(e_Account),
+                                                             p_Parent(p_CurrentScope),
+                                                             u64_NestedCPU(0),
+                                                             u64_NestedWall(0),
+                                                             b_NoProgress(false)
+{
+    p_CurrentScope = this;
+    
+    // Nested scopes follow the outermost scope, the nested CPU time
+    // then always matches the parent
+    if (p_Parent != NULL)
+    {
+        b_Sampled = p_Parent->b_Sampled;
+    }
+    else
+    {
+        b_Sampled = GetSampled();
+    }
+    
+    if (b_Sampled == true)
+    {
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &c_StartCPU);
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &c_StartWall);
+}
+
+ModuleAccounting::Scope::~Scope() noexcept
+{
+    struct timespec c_EndWall;
+    clock_gettime(CLOCK_MONOTONIC, &c_EndWall);
+    
+    MRH_Uint64 u64_CPU = 0;
+    MRH_Uint64 u64_Wall = GetElapsed(c_StartWall, c_EndWall);
+    
+    // Nested scopes are accounted on their own
+    Total& c_Total = ModuleAccounting::Singleton().p_Total[e_Account];
+    ++c_Total.u64_Invocations;
+    c_Total.u64_Wall += u64_Wall > u64_NestedWall ? u64_Wall - u64_NestedWall : 0;
+    
+    if (b_Sampled == true)
+    {
+        struct timespec c_EndCPU;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &c_EndCPU);
+        
+        u64_CPU = GetElapsed(c_StartCPU, c_EndCPU);
+        
+        ++c_Total.u64_Sampled;
+        c_Total.u64_CPU += u64_CPU > u64_NestedCPU ? u64_CPU - u64_NestedCPU : 0;
+    }
+    
+    if (b_NoProgress == true)
+    {
+        ++c_Total.u64_NoProgress;
+    }
+    
+    if (p_Parent != NULL)
+    {
+        p_Parent->u64_NestedCPU += u64_CPU;
+        p_Parent->u64_NestedWall += u64_Wall;
+    }
+    
+    p_CurrentScope = p_Parent;
+}
+
+#endif
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+ModuleAccounting& ModuleAccounting::Singleton() noexcept
+{
+    static ModuleAccounting c_ModuleAccounting;
+    return c_ModuleAccounting;
+}
+
+//*************************************************************************************
+// Setters
+//*************************************************************************************
+
+#ifdef MODULE_ACCOUNTING
+void ModuleAccounting::Scope::SetNoProgress() noexcept
+{
+    b_NoProgress = true;
+}
+#endif
+
+//*************************************************************************************
+// Log
+//*************************************************************************************
+
+void ModuleAccounting::Log() noexcept
+{
+#ifdef MODULE_ACCOUNTING
+    MRH_ModuleLogger& c_Logger = MRH_ModuleLogger::Singleton();
+    
+    for (size_t i = 0; i < ACCOUNT_COUNT; ++i)
+    {
+        // CPU time is only read for sampled calls, scale to all calls
+        MRH_Uint64 u64_CPU = 0;
+        
+        if (p_Total[i].u64_Sampled > 0)
+        {
+            u64_CPU = (MRH_Uint64)((double)(p_Total[i].u64_CPU) *
+                                   ((double)(p_Total[i].u64_Invocations) / (double)(p_Total[i].u64_Sampled)));
+        }
+        
+        c_Logger.Log("ModuleAccounting", std::string(p_AccountName[i]) +
+                                         ": " +
+                                         std::to_string(p_Total[i].u64_Invocations) +
+                                         " calls (" +
+                                         std::to_string(p_Total[i].u64_NoProgress) +
+                                         " without progress), CPU " +
+                                         std::to_string(u64_CPU / 1000) +
+                                         " us, wall " +
+                                         std::to_string(p_Total[i].u64_Wall / 1000) +
+                                         " us",
+                     "ModuleAccounting.cpp", __LINE__);
+    }
+    
+    // Measure the cost of a empty scope, which is what accounting
+    // adds to every measured call
+    Total c_Saved = p_Total[APP_BASE];
+    struct timespec c_Start;
+    struct timespec c_End;
+    
+    clock_gettime(CLOCK_MONOTONIC, &c_Start);
+    
+    for (size_t i = 0; i < MODULE_ACCOUNTING_CALIBRATION_COUNT; ++i)
+    {
+        Scope c_Scope(APP_BASE);
+    }
+    
+    clock_gettime(CLOCK_MONOTONIC, &c_End);
+    p_Total[APP_BASE] = c_Saved;
+    
+    c_Logger.Log("ModuleAccounting", "Overhead per call: " +
+                                     std::to_string(GetElapsed(c_Start, c_End) / MODULE_ACCOUNTING_CALIBRATION_COUNT) +
+                                     " ns",
+                 "ModuleAccounting.cpp", __LINE__);
+#endif
+}
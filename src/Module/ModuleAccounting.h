@@ -0,0 +1,188 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef ModuleAccounting_h
+#define ModuleAccounting_h
+
+// C / C++
+#include <ctime>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+
+
+class ModuleAccounting
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    enum Account
+    {
+        APP_BASE = 0,
+        EVENT_LANES = 1,
+        MIRROR_SPEECH = 2,
+        SPEECH_INPUT = 3,
+        SPEECH_OUTPUT = 4,
+        LOGGER = 5,
+        
+        ACCOUNT_MAX = LOGGER,
+        
+        ACCOUNT_COUNT = ACCOUNT_MAX + 1
+    };
+    
+    class Scope
+    {
+    public:
+        
+        //*************************************************************************************
+        // Constructor / Destructor
+        //*************************************************************************************
+        
+        /**
+         *  Default constructor. Starts measuring for the account.
+         *
+         *  \param e_Account The account to add the measured time to.
+         */
+        
+#ifdef MODULE_ACCOUNTING
+        Scope(Account e_Account) noexcept;
+#else
+        Scope([[maybe_unused]] Account e_Account) noexcept
+        {}
+#endif
+        
+        /**
+         *  Default destructor. Adds the measured time, without the time
+         *  of nested scopes, to the account.
+         */
+        
+#ifdef MODULE_ACCOUNTING
+        ~Scope() noexcept;
+#else
+        ~Scope() noexcept
+        {}
+#endif
+        
+        //*************************************************************************************
+        // Setters
+        //*************************************************************************************
+        
+        /**
+         *  Mark the measured call as one which made no progress.
+         */
+        
+#ifdef MODULE_ACCOUNTING
+        void SetNoProgress() noexcept;
+#else
+        void SetNoProgress() noexcept
+        {}
+#endif
+    
+    private:
+        
+#ifdef MODULE_ACCOUNTING
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        Account e_Account;
+        Scope* p_Parent;
+        
+        // @NOTE: Thread CPU time is a syscall, only sampled scopes read it
+        bool b_Sampled;
+        struct timespec c_StartCPU;
+        struct timespec c_StartWall;
+        MRH_Uint64 u64_NestedCPU;
+        MRH_Uint64 u64_NestedWall;
+        
+        bool b_NoProgress;
+#endif
+    
+    protected:
+        
+    };
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static ModuleAccounting& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Log
+    //*************************************************************************************
+    
+    /**
+     *  Log the summary of all accounts. Nothing is logged if the
+     *  app was built without MODULE_ACCOUNTING.
+     */
+    
+    void Log() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Total
+    {
+        MRH_Uint64 u64_Invocations;
+        MRH_Uint64 u64_NoProgress;
+        MRH_Uint64 u64_Sampled;
+        MRH_Uint64 u64_CPU;
+        MRH_Uint64 u64_Wall;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    ModuleAccounting() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~ModuleAccounting() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    // @NOTE: Modules are only called on the module update thread!
+    Total p_Total[ACCOUNT_COUNT];
+    
+protected:
+    
+};
+
+#endif /* ModuleAccounting_h */
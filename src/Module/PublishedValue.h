@@ -0,0 +1,175 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PublishedValue_h
+#define PublishedValue_h
+
+// C / C++
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// External
+
+// Project
+
+
+template <typename T>
+class PublishedValue
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    class Reader
+    {
+    public:
+        
+        //*************************************************************************************
+        // Constructor / Destructor
+        //*************************************************************************************
+        
+        /**
+         *  Default constructor. Announces the reader, the published value
+         *  is not destroyed until the reader is destroyed.
+         *
+         *  \param c_Published The published value to read.
+         */
+        
+        Reader(PublishedValue& c_Published) noexcept : c_Published(c_Published)
+        {
+            // @NOTE: Set before loading, the publisher waits for this
+            //        to be cleared before destroying a replaced value
+            c_Published.b_Reading = true;
+            p_Value = c_Published.p_Value.load();
+        }
+        
+        /**
+         *  Default destructor.
+         */
+        
+        ~Reader() noexcept
+        {
+            c_Published.b_Reading = false;
+        }
+        
+        //*************************************************************************************
+        // Getters
+        //*************************************************************************************
+        
+        /**
+         *  Get the value read.
+         *
+         *  \return The published value, NULL if none was published.
+         */
+        
+        const T* Get() const noexcept
+        {
+            return p_Value;
+        }
+        
+    private:
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        PublishedValue& c_Published;
+        const T* p_Value;
+        
+    protected:
+        
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    PublishedValue() noexcept : p_Value(NULL),
+                                b_Reading(false)
+    {}
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PublishedValue() noexcept
+    {
+        delete p_Value.load();
+    }
+    
+    //*************************************************************************************
+    // Publish
+    //*************************************************************************************
+    
+    /**
+     *  Replace the published value. The old value is destroyed once no
+     *  reader uses it. Only one thread may publish and only one thread
+     *  may read at a time.
+     *
+     *  \param p_New The value to publish.
+     */
+    
+    void Publish(std::unique_ptr<T> p_New) noexcept
+    {
+        T* p_Old = p_Value.exchange(p_New.release());
+        
+        // Grace period, a reader which loaded the old value before the
+        // exchange is still reading
+        while (b_Reading == true)
+        {
+            std::this_thread::yield();
+        }
+        
+        delete p_Old;
+    }
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the published value without announcing a reader. Only valid
+     *  on the publishing thread.
+     *
+     *  \return The published value, NULL if none was published.
+     */
+    
+    const T* GetPublished() const noexcept
+    {
+        return p_Value.load();
+    }
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::atomic<T*> p_Value;
+    std::atomic<bool> b_Reading;
+    
+protected:
+    
+};
+
+#endif /* PublishedValue_h */
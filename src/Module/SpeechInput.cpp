@@ -21,6 +21,8 @@
 
 // Project
 #include "./SpeechInput.h"
+#include "./ModuleAccounting.h"
+#include "./SpeechText.h"
 
 // Pre-defined
 #ifndef SPEECH_INPUT_TIMEOUT_MS
@@ -32,22 +34,30 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-SpeechInput::SpeechInput(std::string& s_Input) noexcept : MRH_Module("SpeechInput"),
-                                                          c_Timer(SPEECH_INPUT_TIMEOUT_MS),
-                                                          s_Input(s_Input)
-{
-    this->s_Input = "";
-}
+SpeechInput::SpeechInput() noexcept : SpeechAwaiter(SPEECH_INPUT_TIMEOUT_MS),
+                                      s_Input("")
+{}
 
 SpeechInput::~SpeechInput() noexcept
 {}
 
+//*************************************************************************************
+// Await
+//*************************************************************************************
+
+std::string SpeechInput::await_resume() noexcept
+{
+    return std::move(s_Input);
+}
+
 //*************************************************************************************
 // Update
 //*************************************************************************************
 
 void SpeechInput::HandleEvent(const MRH_Event* p_Event) noexcept
 {
+    ModuleAccounting::Scope c_Scope(ModuleAccounting::SPEECH_INPUT);
+    
     MRH_EvD_L_String_S c_String;
     
     if (MRH_EVD_ReadEvent(&c_String, p_Event->u32_Type, p_Event) < 0)
@@ -57,26 +67,26 @@ void SpeechInput::HandleEvent(const MRH_Event* p_Event) noexcept
         return;
     }
     
-    if (strnlen(c_String.p_String, MRH_EVD_L_STRING_BUFFER_MAX_TERMINATED) > 0)
+    size_t us_Length = strnlen(c_String.p_String, MRH_EVD_L_STRING_BUFFER_MAX);
+    size_t us_Written;
+    
+    if (us_Length == 0)
     {
-        s_Input = c_String.p_String;
+        return;
     }
-}
-
-MRH_Module::Result SpeechInput::Update()
-{
-    if (c_Timer.GetTimerFinished() == true || s_Input.size() > 0)
+    
+    // Normalized input is never longer, write it to the result directly
+    s_Input.resize(us_Length);
+    
+    if (SpeechText::Normalize(c_String.p_String, us_Length, s_Input.data(), us_Written, false) == false)
     {
-        return MRH_Module::FINISHED_POP;
+        MRH_ModuleLogger::Singleton().Log("SpeechInput", "Dropped input with invalid UTF-8!",
+                                          "SpeechInput.cpp", __LINE__);
+        us_Written = 0;
     }
     
-    return MRH_Module::IN_PROGRESS;
-}
-
-std::shared_ptr<MRH_Module> SpeechInput::NextModule()
-{
-    throw MRH_ModuleException("SpeechInput",
-                              "No module to switch to!");
+    // Whitespace only input is ignored as well
+    s_Input.resize(us_Written);
 }
 
 //*************************************************************************************
@@ -84,6 +94,11 @@ std::shared_ptr<MRH_Module> SpeechInput::NextModule()
 //*************************************************************************************
 
 bool SpeechInput::CanHandleEvent(MRH_Uint32 u32_Type) noexcept
+{
+    return CanAwaitEvent(u32_Type);
+}
+
+bool SpeechInput::CanAwaitEvent(MRH_Uint32 u32_Type) noexcept
 {
     switch (u32_Type)
     {
@@ -94,3 +109,8 @@ bool SpeechInput::CanHandleEvent(MRH_Uint32 u32_Type) noexcept
             return false;
     }
 }
+
+bool SpeechInput::GetFinished() noexcept
+{
+    return s_Input.size() > 0;
+}
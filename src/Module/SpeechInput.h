@@ -18,14 +18,15 @@
 #define SpeechInput_h
 
 // C / C++
+#include <string>
 
 // External
-#include <libmrhab/Module/MRH_Module.h>
 
 // Project
+#include "./SpeechTask.h"
 
 
-class SpeechInput : public MRH_Module
+class SpeechInput : public SpeechAwaiter
 {
 public:
     
@@ -35,11 +36,9 @@ public:
     
     /**
      *  Default constructor.
-     *
-     *  \param s_Input The input received by listening.
      */
     
-    SpeechInput(std::string& s_Input) noexcept;
+    SpeechInput() noexcept;
     
     /**
      *  Default destructor.
@@ -48,39 +47,35 @@ public:
     ~SpeechInput() noexcept;
     
     //*************************************************************************************
-    // Update
+    // Await
     //*************************************************************************************
     
     /**
-     *  Hand a received event to the module.
+     *  Get the listen result for the resumed task.
      *
-     *  \param p_Event The received event.
+     *  \return The input received by listening, empty on timeout.
      */
     
-    void HandleEvent(const MRH_Event* p_Event) noexcept override;
+    std::string await_resume() noexcept;
     
-    /**
-     *  Perform a module update.
-     *
-     *  \return The module update result.
-     */
-    
-    MRH_Module::Result Update() override;
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
     
     /**
-     *  Get the module to switch to.
+     *  Hand a received event to the operation.
      *
-     *  \return The module switch information.
+     *  \param p_Event The received event.
      */
     
-    std::shared_ptr<MRH_Module> NextModule() override;
+    void HandleEvent(const MRH_Event* p_Event) noexcept override;
     
     //*************************************************************************************
     // Getters
     //*************************************************************************************
     
     /**
-     *  Check if the module can handle a event.
+     *  Check if the operation can handle a event.
      *
      *  \param u32_Type The type of the event to handle.
      *
@@ -89,14 +84,31 @@ public:
     
     bool CanHandleEvent(MRH_Uint32 u32_Type) noexcept override;
     
+    /**
+     *  Check if any input operation can handle a event.
+     *
+     *  \param u32_Type The type of the event to handle.
+     *
+     *  \return true if the event can be used, false if not.
+     */
+    
+    static bool CanAwaitEvent(MRH_Uint32 u32_Type) noexcept;
+    
+    /**
+     *  Check if input was received.
+     *
+     *  \return true if received, false if not.
+     */
+    
+    bool GetFinished() noexcept override;
+    
 private:
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    MRH_ModuleTimer c_Timer;
-    std::string& s_Input;
+    std::string s_Input;
     
 protected:
     
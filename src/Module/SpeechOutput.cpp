@@ -21,6 +21,8 @@
 
 // Project
 #include "./SpeechOutput.h"
+#include "./ExternalCall.h"
+#include "./ModuleAccounting.h"
 
 // Pre-defined
 #ifndef SPEECH_OUTPUT_TIMEOUT_MS
@@ -32,17 +34,23 @@
 // Constructor / Destructor
 //*************************************************************************************
 
-SpeechOutput::SpeechOutput(std::string s_Output) : MRH_Module("SpeechOutput"),
-                                                   c_Timer(SPEECH_OUTPUT_TIMEOUT_MS),
-                                                   u32_SentOutputID((rand() % ((MRH_Uint32) - 1)) + 1),
-                                                   u32_ReceivedOutputID(0)
+SpeechOutput::SpeechOutput(std::string s_Output) noexcept : SpeechAwaiter(SPEECH_OUTPUT_TIMEOUT_MS),
+                                                            u32_SentOutputID((rand() % ((MRH_Uint32) - 1)) + 1),
+                                                            u32_ReceivedOutputID(0)
 {
-    MRH_ModuleLogger::Singleton().Log("SpeechOutput", "Sending output: " +
-                                                      s_Output +
-                                                      " (ID: " +
-                                                      std::to_string(u32_SentOutputID) +
-                                                      ")",
-                                      "SpeechOutput.cpp", __LINE__);
+    ModuleAccounting::Scope c_Scope(ModuleAccounting::SPEECH_OUTPUT);
+    
+    // Logging is accounted on its own
+    {
+        ModuleAccounting::Scope c_LogScope(ModuleAccounting::LOGGER);
+        MRH_ModuleLogger::Singleton().Log("SpeechOutput", "Sending output: " +
+                                                          s_Output +
+                                                          " (ID: " +
+                                                          std::to_string(u32_SentOutputID) +
+                                                          ")",
+                                          "SpeechOutput.cpp", __LINE__);
+    }
+    
     // Setup event data
     MRH_EvD_S_String_U c_Data;
     
@@ -55,32 +63,45 @@ SpeechOutput::SpeechOutput(std::string s_Output) : MRH_Module("SpeechOutput"),
     
     if (p_Event == NULL)
     {
-        throw MRH_ModuleException("SpeechOutput", 
-                                  "Failed to create output event!");
+        c_Result = SpeechError{ "SpeechOutput", "Failed to create output event!" };
+        return;
     }
     
     // Attempt to add to out storage
-    try
-    {
-        MRH_EventStorage::Singleton().Add(p_Event);
-    }
-    catch (MRH_ABException& e)
+    SpeechResult<void> c_Added = ExternalCall::AddEvent(p_Event);
+    
+    if (c_Added.GetSucceeded() == false)
     {
-        MRH_EVD_DestroyEvent(p_Event);
-        throw MRH_ModuleException("SpeechOutput", 
-                                  "Failed to send output: " + e.what2());
+        c_Result = SpeechError{ "SpeechOutput", "Failed to send output: " + c_Added.GetError().s_Message };
     }
 }
 
 SpeechOutput::~SpeechOutput() noexcept
 {}
 
+//*************************************************************************************
+// Await
+//*************************************************************************************
+
+bool SpeechOutput::await_ready() noexcept
+{
+    // Nothing to wait for if the output was never sent
+    return c_Result.GetSucceeded() == false || GetFinished() == true;
+}
+
+SpeechResult<void> SpeechOutput::await_resume() noexcept
+{
+    return c_Result;
+}
+
 //*************************************************************************************
 // Update
 //*************************************************************************************
 
 void SpeechOutput::HandleEvent(const MRH_Event* p_Event) noexcept
 {
+    ModuleAccounting::Scope c_Scope(ModuleAccounting::SPEECH_OUTPUT);
+    
     // @NOTE: CanHandleEvent() allows skipping event type check!
     MRH_EvD_S_String_S c_String;
     
@@ -91,6 +112,7 @@ void SpeechOutput::HandleEvent(const MRH_Event* p_Event) noexcept
     }
     else
     {
+        ModuleAccounting::Scope c_LogScope(ModuleAccounting::LOGGER);
         MRH_ModuleLogger::Singleton().Log("SpeechOutput", "Received output performed: " +
                                                           std::to_string(c_String.u32_ID),
                                           "SpeechOutput.cpp", __LINE__);
@@ -99,27 +121,16 @@ void SpeechOutput::HandleEvent(const MRH_Event* p_Event) noexcept
     }
 }
 
-MRH_Module::Result SpeechOutput::Update()
-{
-    if (u32_SentOutputID == u32_ReceivedOutputID || c_Timer.GetTimerFinished() == true)
-    {
-        return MRH_Module::FINISHED_POP;
-    }
-    
-    return MRH_Module::IN_PROGRESS;
-}
-
-std::shared_ptr<MRH_Module> SpeechOutput::NextModule()
-{
-    throw MRH_ModuleException("SpeechOutput",
-                              "No module to switch to!");
-}
-
 //*************************************************************************************
 // Getters
 //*************************************************************************************
 
 bool SpeechOutput::CanHandleEvent(MRH_Uint32 u32_Type) noexcept
+{
+    return CanAwaitEvent(u32_Type);
+}
+
+bool SpeechOutput::CanAwaitEvent(MRH_Uint32 u32_Type) noexcept
 {
     switch (u32_Type)
     {
@@ -130,3 +141,8 @@ bool SpeechOutput::CanHandleEvent(MRH_Uint32 u32_Type) noexcept
             return false;
     }
 }
+
+bool SpeechOutput::GetFinished() noexcept
+{
+    return u32_SentOutputID == u32_ReceivedOutputID;
+}
@@ -18,14 +18,16 @@
 #define SpeechOutput_h
 
 // C / C++
+#include <string>
 
 // External
-#include <libmrhab/Module/MRH_Module.h>
 
 // Project
+#include "./SpeechTask.h"
+#include "./SpeechResult.h"
 
 
-class SpeechOutput : public MRH_Module
+class SpeechOutput : public SpeechAwaiter
 {
 public:
     
@@ -39,7 +41,7 @@ public:
      *  \param s_Output The string to perform as speech output.
      */
     
-    SpeechOutput(std::string s_Output);
+    SpeechOutput(std::string s_Output) noexcept;
     
     /**
      *  Default destructor.
@@ -48,39 +50,43 @@ public:
     ~SpeechOutput() noexcept;
     
     //*************************************************************************************
-    // Update
+    // Await
     //*************************************************************************************
     
     /**
-     *  Hand a received event to the module.
+     *  Check if the output completed or failed before suspending.
      *
-     *  \param p_Event The received event.
+     *  \return true if completed or failed, false if not.
      */
     
-    void HandleEvent(const MRH_Event* p_Event) noexcept override;
+    bool await_ready() noexcept;
     
     /**
-     *  Perform a module update.
+     *  Get the output result for the resumed task.
      *
-     *  \return The module update result.
+     *  \return The output result. Timeouts are not treated as a error.
      */
     
-    MRH_Module::Result Update() override;
+    SpeechResult<void> await_resume() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
     
     /**
-     *  Get the module to switch to.
+     *  Hand a received event to the operation.
      *
-     *  \return The module switch information.
+     *  \param p_Event The received event.
      */
     
-    std::shared_ptr<MRH_Module> NextModule() override;
+    void HandleEvent(const MRH_Event* p_Event) noexcept override;
     
     //*************************************************************************************
     // Getters
     //*************************************************************************************
     
     /**
-     *  Check if the module can handle a event.
+     *  Check if the operation can handle a event.
      *
      *  \param u32_Type The type of the event to handle.
      *
@@ -89,17 +95,35 @@ public:
     
     bool CanHandleEvent(MRH_Uint32 u32_Type) noexcept override;
     
+    /**
+     *  Check if any output operation can handle a event.
+     *
+     *  \param u32_Type The type of the event to handle.
+     *
+     *  \return true if the event can be used, false if not.
+     */
+    
+    static bool CanAwaitEvent(MRH_Uint32 u32_Type) noexcept;
+    
+    /**
+     *  Check if the output was performed.
+     *
+     *  \return true if performed, false if not.
+     */
+    
+    bool GetFinished() noexcept override;
+    
 private:
     
     //*************************************************************************************
     // Data
     //*************************************************************************************
     
-    MRH_ModuleTimer c_Timer;
-    
     MRH_Uint32 u32_SentOutputID;
     MRH_Uint32 u32_ReceivedOutputID;
     
+    SpeechResult<void> c_Result;
+    
 protected:
     
 };
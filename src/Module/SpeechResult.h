@@ -0,0 +1,177 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SpeechResult_h
+#define SpeechResult_h
+
+// C / C++
+#include <string>
+#include <variant>
+#include <utility>
+
+// External
+
+// Project
+
+
+struct SpeechError
+{
+    std::string s_Source;
+    std::string s_Message;
+};
+
+template <typename T>
+class SpeechResult
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Value constructor.
+     *
+     *  \param c_Value The result value.
+     */
+    
+    SpeechResult(T c_Value) noexcept : v_Result(std::in_place_index<0>, std::move(c_Value))
+    {}
+    
+    /**
+     *  Error constructor.
+     *
+     *  \param c_Error The error which occured.
+     */
+    
+    SpeechResult(SpeechError c_Error) noexcept : v_Result(std::in_place_index<1>, std::move(c_Error))
+    {}
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the result holds a value.
+     *
+     *  \return true if a value is held, false if a error is held.
+     */
+    
+    bool GetSucceeded() const noexcept
+    {
+        return v_Result.index() == 0;
+    }
+    
+    /**
+     *  Get the result value. Only valid if succeeded.
+     *
+     *  \return The result value.
+     */
+    
+    T& GetValue() noexcept
+    {
+        return *std::get_if<0>(&v_Result);
+    }
+    
+    /**
+     *  Get the result error. Only valid if not succeeded.
+     *
+     *  \return The result error.
+     */
+    
+    SpeechError const& GetError() const noexcept
+    {
+        return *std::get_if<1>(&v_Result);
+    }
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::variant<T, SpeechError> v_Result;
+    
+protected:
+    
+};
+
+template <>
+class SpeechResult<void>
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    SpeechResult() noexcept : b_Succeeded(true)
+    {}
+    
+    /**
+     *  Error constructor.
+     *
+     *  \param c_Error The error which occured.
+     */
+    
+    SpeechResult(SpeechError c_Error) noexcept : b_Succeeded(false),
+                                                 c_Error(std::move(c_Error))
+    {}
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the result succeeded.
+     *
+     *  \return true if succeeded, false if a error is held.
+     */
+    
+    bool GetSucceeded() const noexcept
+    {
+        return b_Succeeded;
+    }
+    
+    /**
+     *  Get the result error. Only valid if not succeeded.
+     *
+     *  \return The result error.
+     */
+    
+    SpeechError const& GetError() const noexcept
+    {
+        return c_Error;
+    }
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    bool b_Succeeded;
+    SpeechError c_Error;
+    
+protected:
+    
+};
+
+#endif /* SpeechResult_h */
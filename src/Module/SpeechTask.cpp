@@ -0,0 +1,254 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <new>
+
+// External
+
+// Project
+#include "./SpeechTask.h"
+
+// Pre-defined
+#ifndef SPEECH_TASK_FRAME_SIZE
+    #define SPEECH_TASK_FRAME_SIZE 1024
+#endif
+#ifndef SPEECH_TASK_FRAME_COUNT
+    #define SPEECH_TASK_FRAME_COUNT 2
+#endif
+
+namespace
+{
+    // @NOTE: Tasks are only created and destroyed on the module update
+    //        thread, the pool is not shared!
+    struct alignas(std::max_align_t) Frame
+    {
+        unsigned char p_Data[SPEECH_TASK_FRAME_SIZE];
+    };
+    
+    Frame p_FramePool[SPEECH_TASK_FRAME_COUNT];
+    bool p_FramePoolUsed[SPEECH_TASK_FRAME_COUNT] = { false };
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+SpeechTask::SpeechTask() noexcept : c_Handle(nullptr)
+{}
+
+SpeechTask::SpeechTask(std::coroutine_handle<promise_type> c_Handle) noexcept : c_Handle(c_Handle)
+{}
+
+SpeechTask::SpeechTask(SpeechTask&& c_SpeechTask) noexcept : c_Handle(c_SpeechTask.c_Handle)
+{
+    c_SpeechTask.c_Handle = nullptr;
+}
+
+SpeechTask::~SpeechTask() noexcept
+{
+    if (c_Handle)
+    {
+        c_Handle.destroy();
+    }
+}
+
+SpeechAwaiter::SpeechAwaiter(MRH_Uint32 u32_TimeoutMS) noexcept : c_Timer(u32_TimeoutMS)
+{}
+
+SpeechAwaiter::~SpeechAwaiter() noexcept
+{}
+
+//*************************************************************************************
+// Operators
+//*************************************************************************************
+
+SpeechTask& SpeechTask::operator=(SpeechTask&& c_SpeechTask) noexcept
+{
+    if (this != &c_SpeechTask)
+    {
+        if (c_Handle)
+        {
+            c_Handle.destroy();
+        }
+        
+        c_Handle = c_SpeechTask.c_Handle;
+        c_SpeechTask.c_Handle = nullptr;
+    }
+    
+    return *this;
+}
+
+//*************************************************************************************
+// Coroutine
+//*************************************************************************************
+
+SpeechTask SpeechTask::promise_type::get_return_object() noexcept
+{
+    p_Awaiter = NULL;
+    return SpeechTask(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+std::suspend_always SpeechTask::promise_type::initial_suspend() noexcept
+{
+    // Started by the first update, not on creation
+    return {};
+}
+
+std::suspend_always SpeechTask::promise_type::final_suspend() noexcept
+{
+    // Keep the frame so the owner can check the result
+    return {};
+}
+
+void SpeechTask::promise_type::return_void() noexcept
+{}
+
+void SpeechTask::promise_type::unhandled_exception() noexcept
+{
+    // @NOTE: Module files are built without exceptions, flow errors
+    //        are results and nothing reaches this
+    std::terminate();
+}
+
+//*************************************************************************************
+// Frame
+//*************************************************************************************
+
+void* SpeechTask::promise_type::operator new(std::size_t us_Size)
+{
+    if (us_Size <= SPEECH_TASK_FRAME_SIZE)
+    {
+        for (std::size_t i = 0; i < SPEECH_TASK_FRAME_COUNT; ++i)
+        {
+            if (p_FramePoolUsed[i] == false)
+            {
+                p_FramePoolUsed[i] = true;
+                return p_FramePool[i].p_Data;
+            }
+        }
+    }
+    
+    // Pool exhausted or frame too large
+    return ::operator new(us_Size);
+}
+
+void SpeechTask::promise_type::operator delete(void* p_Frame, std::size_t us_Size) noexcept
+{
+    for (std::size_t i = 0; i < SPEECH_TASK_FRAME_COUNT; ++i)
+    {
+        if (p_Frame == p_FramePool[i].p_Data)
+        {
+            p_FramePoolUsed[i] = false;
+            return;
+        }
+    }
+    
+    ::operator delete(p_Frame, us_Size);
+}
+
+//*************************************************************************************
+// Await
+//*************************************************************************************
+
+bool SpeechAwaiter::await_ready() noexcept
+{
+    return GetFinished();
+}
+
+void SpeechAwaiter::await_suspend(std::coroutine_handle<SpeechTask::promise_type> c_Handle) noexcept
+{
+    c_Handle.promise().p_Awaiter = this;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+bool SpeechTask::HandleEvent(const MRH_Event* p_Event) noexcept
+{
+    if (CanHandleEvent(p_Event->u32_Type) == false)
+    {
+        return false;
+    }
+    
+    SpeechAwaiter* p_Awaiter = c_Handle.promise().p_Awaiter;
+    p_Awaiter->HandleEvent(p_Event);
+    
+    // Continue the flow right away, no need to wait for the next update
+    if (p_Awaiter->GetFinished() == true)
+    {
+        Resume();
+        return true;
+    }
+    
+    return false;
+}
+
+bool SpeechTask::Update() noexcept
+{
+    if (!c_Handle)
+    {
+        return false;
+    }
+    
+    bool b_Resumed = false;
+    
+    if (c_Handle.done() == false)
+    {
+        SpeechAwaiter* p_Awaiter = c_Handle.promise().p_Awaiter;
+        
+        // No awaiter means the task was not started yet
+        if (p_Awaiter == NULL || p_Awaiter->GetTimerFinished() == true)
+        {
+            Resume();
+            b_Resumed = true;
+        }
+    }
+    
+    return b_Resumed;
+}
+
+void SpeechTask::Resume() noexcept
+{
+    c_Handle.promise().p_Awaiter = NULL;
+    c_Handle.resume();
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+bool SpeechTask::CanHandleEvent(MRH_Uint32 u32_Type) noexcept
+{
+    if (!c_Handle || c_Handle.done() == true || c_Handle.promise().p_Awaiter == NULL)
+    {
+        return false;
+    }
+    
+    return c_Handle.promise().p_Awaiter->CanHandleEvent(u32_Type);
+}
+
+bool SpeechTask::GetFinished() const noexcept
+{
+    return !c_Handle || c_Handle.done() == true;
+}
+
+bool SpeechAwaiter::GetTimerFinished() noexcept
+{
+    return c_Timer.GetTimerFinished();
+}
@@ -0,0 +1,298 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SpeechTask_h
+#define SpeechTask_h
+
+// C / C++
+#include <coroutine>
+#include <exception>
+#include <cstddef>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+
+
+class SpeechAwaiter;
+
+class SpeechTask
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    class promise_type
+    {
+    public:
+        
+        //*************************************************************************************
+        // Coroutine
+        //*************************************************************************************
+        
+        SpeechTask get_return_object() noexcept;
+        std::suspend_always initial_suspend() noexcept;
+        std::suspend_always final_suspend() noexcept;
+        void return_void() noexcept;
+        void unhandled_exception() noexcept;
+        
+        //*************************************************************************************
+        // Frame
+        //*************************************************************************************
+        
+        /**
+         *  Allocate a coroutine frame from the frame pool.
+         *
+         *  \param us_Size The required frame size.
+         *
+         *  \return The allocated frame.
+         */
+        
+        static void* operator new(std::size_t us_Size);
+        
+        /**
+         *  Return a coroutine frame to the frame pool.
+         *
+         *  \param p_Frame The frame to return.
+         *  \param us_Size The frame size.
+         */
+        
+        static void operator delete(void* p_Frame, std::size_t us_Size) noexcept;
+        
+        //*************************************************************************************
+        // Data
+        //*************************************************************************************
+        
+        SpeechAwaiter* p_Awaiter;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    SpeechTask() noexcept;
+    
+    /**
+     *  Move constructor.
+     *
+     *  \param c_SpeechTask The task to move.
+     */
+    
+    SpeechTask(SpeechTask&& c_SpeechTask) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~SpeechTask() noexcept;
+    
+    //*************************************************************************************
+    // Operators
+    //*************************************************************************************
+    
+    /**
+     *  Move assignment operator.
+     *
+     *  \param c_SpeechTask The task to move.
+     *
+     *  \return The moved task.
+     */
+    
+    SpeechTask& operator=(SpeechTask&& c_SpeechTask) noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Hand a received event to the awaited operation. The task is resumed
+     *  directly if the event completes the operation.
+     *
+     *  \param p_Event The received event.
+     *
+     *  \return true if the task was resumed, false if not.
+     */
+    
+    bool HandleEvent(const MRH_Event* p_Event) noexcept;
+    
+    /**
+     *  Start the task or resume it if the awaited operation timed out.
+     *
+     *  \return true if the task was resumed, false if not.
+     */
+    
+    bool Update() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the awaited operation can handle a event.
+     *
+     *  \param u32_Type The type of the event to handle.
+     *
+     *  \return true if the event can be used, false if not.
+     */
+    
+    bool CanHandleEvent(MRH_Uint32 u32_Type) noexcept;
+    
+    /**
+     *  Check if the task finished.
+     *
+     *  \return true if finished, false if not.
+     */
+    
+    bool GetFinished() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Handle constructor.
+     *
+     *  \param c_Handle The coroutine handle to own.
+     */
+    
+    SpeechTask(std::coroutine_handle<promise_type> c_Handle) noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Resume the suspended coroutine.
+     */
+    
+    void Resume() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::coroutine_handle<promise_type> c_Handle;
+    
+protected:
+    
+};
+
+class SpeechAwaiter
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param u32_TimeoutMS The time in milliseconds until the operation times out.
+     */
+    
+    SpeechAwaiter(MRH_Uint32 u32_TimeoutMS) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    virtual ~SpeechAwaiter() noexcept;
+    
+    //*************************************************************************************
+    // Await
+    //*************************************************************************************
+    
+    /**
+     *  Check if the operation completed before suspending.
+     *
+     *  \return true if completed, false if not.
+     */
+    
+    bool await_ready() noexcept;
+    
+    /**
+     *  Register the operation as the one awaited by the suspended task.
+     *
+     *  \param c_Handle The suspended task.
+     */
+    
+    void await_suspend(std::coroutine_handle<SpeechTask::promise_type> c_Handle) noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Hand a received event to the operation.
+     *
+     *  \param p_Event The received event.
+     */
+    
+    virtual void HandleEvent(const MRH_Event* p_Event) noexcept = 0;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the operation can handle a event.
+     *
+     *  \param u32_Type The type of the event to handle.
+     *
+     *  \return true if the event can be used, false if not.
+     */
+    
+    virtual bool CanHandleEvent(MRH_Uint32 u32_Type) noexcept = 0;
+    
+    /**
+     *  Check if the operation completed.
+     *
+     *  \return true if completed, false if not.
+     */
+    
+    virtual bool GetFinished() noexcept = 0;
+    
+    /**
+     *  Check if the operation timed out.
+     *
+     *  \return true if timed out, false if not.
+     */
+    
+    bool GetTimerFinished() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    MRH_ModuleTimer c_Timer;
+    
+protected:
+    
+};
+
+#endif /* SpeechTask_h */
@@ -0,0 +1,248 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+// External
+
+// Project
+#include "./SpeechText.h"
+
+// Pre-defined
+#if defined(__SSE2__) && !defined(SPEECH_TEXT_SCALAR)
+    #include <emmintrin.h>
+    #define SPEECH_TEXT_SSE2
+#endif
+#ifndef SPEECH_TEXT_MIN_RUN
+    #define SPEECH_TEXT_MIN_RUN 2
+#endif
+#ifndef SPEECH_TEXT_MAX_SCALAR_RUN
+    #define SPEECH_TEXT_MAX_SCALAR_RUN 256
+#endif
+
+namespace
+{
+    inline bool IsSpace(uint8_t u8_Byte) noexcept
+    {
+        // Whitespace and control characters
+        return u8_Byte <= 0x20 || u8_Byte == 0x7F;
+    }
+
+#ifdef SPEECH_TEXT_SSE2
+    inline __m128i FoldCase(__m128i c_Block) noexcept
+    {
+        __m128i c_Upper = _mm_and_si128(_mm_cmpgt_epi8(c_Block, _mm_set1_epi8('A' - 1)),
+                                        _mm_cmplt_epi8(c_Block, _mm_set1_epi8('Z' + 1)));
+        return _mm_add_epi8(c_Block, _mm_and_si128(c_Upper, _mm_set1_epi8(0x20)));
+    }
+#endif
+}
+
+
+//*************************************************************************************
+// Normalize
+//*************************************************************************************
+
+bool SpeechText::Normalize(const char* p_Input, size_t us_Length, char* p_Output, size_t& us_Written, bool b_FoldCase) noexcept
+{
+    const uint8_t* p_In = reinterpret_cast<const uint8_t*>(p_Input);
+    uint8_t* p_Out = reinterpret_cast<uint8_t*>(p_Output);
+    size_t us_In = 0;
+    size_t us_Out = 0;
+    
+    // Whitespace is only written once followed by text, which
+    // trims both ends
+    bool b_Space = false;
+
+#ifdef SPEECH_TEXT_SSE2
+    // Blocks which barely advance are finished scalar, short runs
+    // are cheaper to handle by byte
+    size_t us_ScalarEnd = 0;
+    size_t us_ScalarRun = 16;
+#endif
+    
+    us_Written = 0;
+    
+    while (us_In < us_Length)
+    {
+#ifdef SPEECH_TEXT_SSE2
+        // Copy printable ASCII 16 bytes at a time, up to the first byte
+        // which needs a closer look
+        if (us_In >= us_ScalarEnd && us_Length - us_In >= 16)
+        {
+            __m128i c_Block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_In + us_In));
+            __m128i c_Special = _mm_or_si128(_mm_cmplt_epi8(c_Block, _mm_set1_epi8(0x21)),
+                                             _mm_cmpeq_epi8(c_Block, _mm_set1_epi8(0x7F)));
+            
+            // Bytes >= 0x80 are negative, cmplt already marks them
+            int i_Special = _mm_movemask_epi8(c_Special);
+            int i_Blank = _mm_movemask_epi8(_mm_cmpeq_epi8(c_Block, _mm_set1_epi8(' ')));
+            
+            // A single space between text inside the block is already
+            // normalized and can be copied with it
+            int i_Text = ~i_Special & 0xFFFF;
+            int i_Keep = i_Text | (i_Blank & (i_Text << 1) & (i_Text >> 1));
+            int i_Printable = __builtin_ctz(~i_Keep);
+            
+            if (i_Printable > 0)
+            {
+                if (b_Space == true)
+                {
+                    p_Out[us_Out++] = ' ';
+                    b_Space = false;
+                }
+                
+                if (b_FoldCase == true)
+                {
+                    c_Block = FoldCase(c_Block);
+                }
+                
+                // @NOTE: A written space always replaced at least one input
+                //        byte, the full block stays inside the output buffer
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(p_Out + us_Out), c_Block);
+                
+                if (i_Printable < SPEECH_TEXT_MIN_RUN)
+                {
+                    us_ScalarEnd = us_In + us_ScalarRun;
+                    us_ScalarRun = std::min(us_ScalarRun * 2, (size_t) SPEECH_TEXT_MAX_SCALAR_RUN);
+                }
+                else
+                {
+                    us_ScalarRun = 16;
+                }
+                
+                us_In += i_Printable;
+                us_Out += i_Printable;
+                continue;
+            }
+            
+            // Skip a leading whitespace run at once, multi byte
+            // sequences are left to the scalar check
+            int i_Whitespace = i_Special & ~_mm_movemask_epi8(c_Block);
+            int i_Skip = __builtin_ctz(~i_Whitespace);
+            
+            if (i_Skip > 0)
+            {
+                b_Space = b_Space || us_Out > 0;
+                us_In += i_Skip;
+                continue;
+            }
+            
+            us_ScalarEnd = us_In + us_ScalarRun;
+            us_ScalarRun = std::min(us_ScalarRun * 2, (size_t) SPEECH_TEXT_MAX_SCALAR_RUN);
+        }
+#endif
+        uint8_t u8_Lead = p_In[us_In];
+        
+        if (u8_Lead < 0x80)
+        {
+            if (IsSpace(u8_Lead) == true)
+            {
+                b_Space = us_Out > 0;
+            }
+            else
+            {
+                if (b_Space == true)
+                {
+                    p_Out[us_Out++] = ' ';
+                    b_Space = false;
+                }
+                
+                if (b_FoldCase == true && u8_Lead >= 'A' && u8_Lead <= 'Z')
+                {
+                    u8_Lead += 0x20;
+                }
+                
+                p_Out[us_Out++] = u8_Lead;
+            }
+            
+            ++us_In;
+            continue;
+        }
+        
+        // Multi byte sequence
+        size_t us_Size;
+        uint32_t u32_CodePoint;
+        uint32_t u32_Min;
+        
+        if ((u8_Lead & 0xE0) == 0xC0)
+        {
+            us_Size = 2;
+            u32_CodePoint = u8_Lead & 0x1F;
+            u32_Min = 0x80;
+        }
+        else if ((u8_Lead & 0xF0) == 0xE0)
+        {
+            us_Size = 3;
+            u32_CodePoint = u8_Lead & 0x0F;
+            u32_Min = 0x800;
+        }
+        else if ((u8_Lead & 0xF8) == 0xF0)
+        {
+            us_Size = 4;
+            u32_CodePoint = u8_Lead & 0x07;
+            u32_Min = 0x10000;
+        }
+        else
+        {
+            return false;
+        }
+        
+        if (us_Length - us_In < us_Size)
+        {
+            return false;
+        }
+        
+        for (size_t i = 1; i < us_Size; ++i)
+        {
+            if ((p_In[us_In + i] & 0xC0) != 0x80)
+            {
+                return false;
+            }
+            
+            u32_CodePoint = (u32_CodePoint << 6) | (p_In[us_In + i] & 0x3F);
+        }
+        
+        // Overlong, surrogate or out of range
+        if (u32_CodePoint < u32_Min || u32_CodePoint > 0x10FFFF || (u32_CodePoint >= 0xD800 && u32_CodePoint <= 0xDFFF))
+        {
+            return false;
+        }
+        
+        if (b_Space == true)
+        {
+            p_Out[us_Out++] = ' ';
+            b_Space = false;
+        }
+        
+        memcpy(p_Out + us_Out, p_In + us_In, us_Size);
+        
+        // Latin-1 capitals (except U+00D7) only differ in the last byte
+        if (b_FoldCase == true && u32_CodePoint >= 0xC0 && u32_CodePoint <= 0xDE && u32_CodePoint != 0xD7)
+        {
+            p_Out[us_Out + 1] += 0x20;
+        }
+        
+        us_In += us_Size;
+        us_Out += us_Size;
+    }
+    
+    us_Written = us_Out;
+    return true;
+}
@@ -0,0 +1,68 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SpeechText_h
+#define SpeechText_h
+
+// C / C++
+#include <cstddef>
+
+// External
+
+// Project
+
+
+class SpeechText
+{
+public:
+    
+    //*************************************************************************************
+    // Normalize
+    //*************************************************************************************
+    
+    /**
+     *  Validate and normalize a UTF-8 string in one pass. Whitespace and
+     *  control character runs are collapsed to a single space and removed
+     *  at both ends. The output is never longer than the input.
+     *
+     *  \param p_Input The UTF-8 string to normalize.
+     *  \param us_Length The length of the string in bytes.
+     *  \param p_Output The output buffer, at least us_Length bytes.
+     *  \param us_Written The amount of bytes written to the output buffer.
+     *  \param b_FoldCase If ASCII and Latin-1 letters should be folded to lower case.
+     *
+     *  \return true if the string is valid UTF-8, false if not.
+     */
+    
+    static bool Normalize(const char* p_Input, size_t us_Length, char* p_Output, size_t& us_Written, bool b_FoldCase) noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    SpeechText() noexcept = delete;
+    
+protected:
+    
+};
+
+#endif /* SpeechText_h */
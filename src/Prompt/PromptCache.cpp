@@ -0,0 +1,312 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+// External
+#include <libmrhvt/Output/MRH_OutputGenerator.h>
+#include <libmrhvt/String/MRH_LocalisedPath.h>
+
+// Project
+#include "./PromptCache.h"
+#include "../Module/ExternalCall.h"
+
+// Pre-defined
+#ifndef PROMPT_CACHE_SETTLE_MS
+    #define PROMPT_CACHE_SETTLE_MS 100
+#endif
+
+// @NOTE: Only the libmrhvt calls report errors with exceptions, this
+//        file has to be built with exceptions!
+
+namespace
+{
+    constexpr MRH_Uint32 u32_LocaleMask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE;
+    constexpr MRH_Uint32 u32_RootMask = IN_CREATE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_ONLYDIR;
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+PromptCache::PromptCache(std::string const& s_Directory, std::string const& s_File) noexcept : s_Directory(s_Directory),
+                                                                                                s_File(s_File),
+                                                                                                i_WatchDescriptor(-1),
+                                                                                                i_StopDescriptor(-1)
+{}
+
+SpeechResult<std::unique_ptr<PromptCache>> PromptCache::Create(std::string const& s_Directory, std::string const& s_File) noexcept
+{
+    std::unique_ptr<PromptCache> p_Cache(new PromptCache(s_Directory, s_File));
+    
+    // @NOTE: The locale is resolved once, each locale has its own
+    //        directory in the output directory
+    try
+    {
+        // Normalized like the table keys
+        p_Cache->s_Path = std::filesystem::path(MRH_LocalisedPath::GetPath(s_Directory, s_File)).lexically_normal().string();
+    }
+    catch (MRH_VTException& e)
+    {
+        return SpeechError{ "PromptCache", "Failed to resolve prompts: " + e.what2() };
+    }
+    
+    p_Cache->s_RootPath = std::filesystem::path(p_Cache->s_Path).parent_path().parent_path().string();
+    
+    if (p_Cache->s_RootPath.size() == 0)
+    {
+        p_Cache->s_RootPath = ".";
+    }
+    
+    if ((p_Cache->i_WatchDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) < 0 ||
+        (p_Cache->i_StopDescriptor = eventfd(0, EFD_CLOEXEC)) < 0)
+    {
+        return SpeechError{ "PromptCache", "Failed to watch prompts: " + std::string(strerror(errno)) };
+    }
+    
+    // Prompts are parsed on the watcher thread, output is read from
+    // file until the first table was published
+    try
+    {
+        p_Cache->c_Thread = std::thread(Watch, p_Cache.get());
+    }
+    catch (std::system_error& e)
+    {
+        return SpeechError{ "PromptCache", "Failed to start watch thread: " + std::string(e.what()) };
+    }
+    
+    return p_Cache;
+}
+
+PromptCache::~PromptCache() noexcept
+{
+    if (c_Thread.joinable() == true)
+    {
+        MRH_Uint64 u64_Stop = 1;
+        
+        while (write(i_StopDescriptor, &u64_Stop, sizeof(u64_Stop)) < 0 && errno == EINTR)
+        {}
+        
+        c_Thread.join();
+    }
+    
+    if (i_WatchDescriptor >= 0)
+    {
+        close(i_WatchDescriptor);
+    }
+    
+    if (i_StopDescriptor >= 0)
+    {
+        close(i_StopDescriptor);
+    }
+}
+
+//*************************************************************************************
+// Output
+//*************************************************************************************
+
+SpeechResult<std::string> PromptCache::GenerateOutput() noexcept
+{
+    {
+        PublishedValue<Table>::Reader c_Reader(c_Table);
+        const Table* p_Current = c_Reader.Get();
+        
+        if (p_Current != NULL)
+        {
+            auto Generator = p_Current->m_Generator.find(s_Path);
+            
+            // The file might have been added after the last build
+            if (Generator == p_Current->m_Generator.end())
+            {
+                return ExternalCall::GenerateOutput(s_Directory, s_File);
+            }
+            
+            try
+            {
+                return Generator->second->Generate();
+            }
+            catch (MRH_VTException& e)
+            {
+                return SpeechError{ "PromptCache", "Failed to generate output: " + e.what2() };
+            }
+            catch (std::exception& e)
+            {
+                return SpeechError{ "PromptCache", "Failed to generate output: " + std::string(e.what()) };
+            }
+        }
+    }
+    
+    // Not parsed yet, read the file like without the cache
+    return ExternalCall::GenerateOutput(s_Directory, s_File);
+}
+
+//*************************************************************************************
+// Table
+//*************************************************************************************
+
+SpeechResult<std::unique_ptr<PromptCache::Table>> PromptCache::Build(const Table* p_Previous) noexcept
+{
+    std::unique_ptr<Table> p_New(new Table());
+    
+    // New locale directories have to be watched as well
+    if (inotify_add_watch(i_WatchDescriptor, s_RootPath.c_str(), u32_RootMask) < 0)
+    {
+        return SpeechError{ "PromptCache", "Failed to watch " + s_RootPath + ": " + std::string(strerror(errno)) };
+    }
+    
+    std::error_code c_Error;
+    std::filesystem::directory_iterator c_Root(s_RootPath, c_Error);
+    
+    if (c_Error)
+    {
+        return SpeechError{ "PromptCache", "Failed to read " + s_RootPath + ": " + c_Error.message() };
+    }
+    
+    for (; c_Root != std::filesystem::directory_iterator(); c_Root.increment(c_Error))
+    {
+        if (c_Error)
+        {
+            return SpeechError{ "PromptCache", "Failed to read " + s_RootPath + ": " + c_Error.message() };
+        }
+        else if (c_Root->is_directory(c_Error) == false)
+        {
+            continue;
+        }
+        
+        // Files are replaced by moving, watch the directory not the file
+        std::string s_LocalePath = c_Root->path().string();
+        
+        if (inotify_add_watch(i_WatchDescriptor, s_LocalePath.c_str(), u32_LocaleMask) < 0)
+        {
+            MRH_ModuleLogger::Singleton().Log("PromptCache", "Failed to watch " +
+                                                             s_LocalePath +
+                                                             ": " +
+                                                             std::string(strerror(errno)),
+                                              "PromptCache.cpp", __LINE__);
+        }
+        
+        // Removed files are not in the new table
+        std::string s_FilePath = (c_Root->path() / s_File).lexically_normal().string();
+        
+        if (std::filesystem::is_regular_file(s_FilePath, c_Error) == false)
+        {
+            continue;
+        }
+        
+        try
+        {
+            p_New->m_Generator[s_FilePath] = std::make_shared<MRH_OutputGenerator>(s_FilePath);
+        }
+        catch (MRH_VTException& e)
+        {
+            std::string s_Message = "Failed to load prompts for ";
+            
+            if (p_Previous != NULL)
+            {
+                auto Previous = p_Previous->m_Generator.find(s_FilePath);
+                
+                if (Previous != p_Previous->m_Generator.end())
+                {
+                    p_New->m_Generator[s_FilePath] = Previous->second;
+                    s_Message = "Keeping last prompts for ";
+                }
+            }
+            
+            MRH_ModuleLogger::Singleton().Log("PromptCache", s_Message +
+                                                             s_FilePath +
+                                                             ": " +
+                                                             e.what2(),
+                                              "PromptCache.cpp", __LINE__);
+        }
+    }
+    
+    return p_New;
+}
+
+void PromptCache::Rebuild() noexcept
+{
+    SpeechResult<std::unique_ptr<Table>> c_Built = Build(c_Table.GetPublished());
+    
+    if (c_Built.GetSucceeded() == false)
+    {
+        MRH_ModuleLogger::Singleton().Log("PromptCache", "Failed to load prompts: " +
+                                                         c_Built.GetError().s_Message,
+                                          "PromptCache.cpp", __LINE__);
+        return;
+    }
+    
+    c_Table.Publish(std::move(c_Built.GetValue()));
+    
+    MRH_ModuleLogger::Singleton().Log("PromptCache", "Loaded prompts",
+                                      "PromptCache.cpp", __LINE__);
+}
+
+//*************************************************************************************
+// Watch
+//*************************************************************************************
+
+void PromptCache::Watch(PromptCache* p_Instance) noexcept
+{
+    // The first table is built here, initializing doesn't wait for it
+    p_Instance->Rebuild();
+    
+    alignas(struct inotify_event) char p_Buffer[4096];
+    struct pollfd p_Poll[2] =
+    {
+        { p_Instance->i_WatchDescriptor, POLLIN, 0 },
+        { p_Instance->i_StopDescriptor, POLLIN, 0 }
+    };
+    
+    while (true)
+    {
+        if (poll(p_Poll, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            
+            MRH_ModuleLogger::Singleton().Log("PromptCache", "Failed to wait for prompt changes: " +
+                                                             std::string(strerror(errno)),
+                                              "PromptCache.cpp", __LINE__);
+            return;
+        }
+        
+        // Editors save in multiple steps, rebuild once changes settled
+        do
+        {
+            if (p_Poll[1].revents != 0)
+            {
+                return;
+            }
+            
+            while (read(p_Instance->i_WatchDescriptor, p_Buffer, sizeof(p_Buffer)) > 0)
+            {}
+        }
+        while (poll(p_Poll, 2, PROMPT_CACHE_SETTLE_MS) > 0);
+        
+        p_Instance->Rebuild();
+    }
+}
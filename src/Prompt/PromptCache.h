@@ -0,0 +1,157 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef PromptCache_h
+#define PromptCache_h
+
+// C / C++
+#include <string>
+#include <memory>
+#include <map>
+#include <atomic>
+#include <thread>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+#include "../Module/SpeechResult.h"
+#include "../Module/PublishedValue.h"
+
+
+class MRH_OutputGenerator;
+
+class PromptCache
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Load the prompts for all locales and watch them for changes. The
+     *  prompts are loaded in the background.
+     *
+     *  \param s_Directory The output directory.
+     *  \param s_File The output file name.
+     *
+     *  \return The loaded prompt cache.
+     */
+    
+    static SpeechResult<std::unique_ptr<PromptCache>> Create(std::string const& s_Directory, std::string const& s_File) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~PromptCache() noexcept;
+    
+    //*************************************************************************************
+    // Output
+    //*************************************************************************************
+    
+    /**
+     *  Generate a output string for the current locale. The output file
+     *  is only read if its prompts were not loaded.
+     *
+     *  \return The call result.
+     */
+    
+    SpeechResult<std::string> GenerateOutput() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Table
+    {
+        // Parsed prompt files, by file path
+        std::map<std::string, std::shared_ptr<MRH_OutputGenerator>> m_Generator;
+    };
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param s_Directory The output directory.
+     *  \param s_File The output file name.
+     */
+    
+    PromptCache(std::string const& s_Directory, std::string const& s_File) noexcept;
+    
+    //*************************************************************************************
+    // Table
+    //*************************************************************************************
+    
+    /**
+     *  Parse the prompt files of all locales and watch their directories.
+     *  Only existing files are added, files which fail to parse keep
+     *  their last parsed prompts.
+     *
+     *  \param p_Previous The current table, NULL if none.
+     *
+     *  \return The new table.
+     */
+    
+    SpeechResult<std::unique_ptr<Table>> Build(const Table* p_Previous) noexcept;
+    
+    /**
+     *  Build and publish a new table. The current table is kept if
+     *  building fails.
+     */
+    
+    void Rebuild() noexcept;
+    
+    //*************************************************************************************
+    // Watch
+    //*************************************************************************************
+    
+    /**
+     *  Rebuild the table when prompt files change.
+     *
+     *  \param p_Instance The prompt cache to watch for.
+     */
+    
+    static void Watch(PromptCache* p_Instance) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::string s_RootPath;
+    std::string s_Directory;
+    std::string s_File;
+    std::string s_Path;
+    
+    // Published table, read without locking
+    PublishedValue<Table> c_Table;
+    
+    // File watching
+    int i_WatchDescriptor;
+    int i_StopDescriptor;
+    std::thread c_Thread;
+    
+protected:
+    
+};
+
+#endif /* PromptCache_h */
@@ -0,0 +1,218 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <ctime>
+
+// External
+
+// Project
+#include "./SessionSnapshot.h"
+#include "../Revision.h"
+
+// Pre-defined
+#ifndef SESSION_SNAPSHOT_STRING_MAX
+    #define SESSION_SNAPSHOT_STRING_MAX 8192
+#endif
+#ifndef SESSION_SNAPSHOT_MAX_AGE_S
+    #define SESSION_SNAPSHOT_MAX_AGE_S 300
+#endif
+
+namespace
+{
+    constexpr char p_SnapshotMagic[8] = { 'M', 'R', 'H', 'S', 'N', 'A', 'P', 'S' };
+    constexpr MRH_Uint32 u32_SnapshotVersion = 3;
+    constexpr MRH_Uint32 u32_SnapshotRevision = (REVISION_MAJOR << 16) | (REVISION_MINOR << 8) | REVISION_PATCH;
+    
+    constexpr MRH_Uint32 u32_FlagRecalled = 1 << 0;
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+SessionSnapshot::SessionSnapshot(MRH_Uint32 u32_State, std::string s_Output, std::string s_Input, bool b_Recalled) noexcept : u32_State(u32_State),
+                                                                                                                              s_Output(std::move(s_Output)),
+                                                                                                                              s_Input(std::move(s_Input)),
+                                                                                                                              b_Recalled(b_Recalled)
+{}
+
+SessionSnapshot::~SessionSnapshot() noexcept
+{}
+
+//*************************************************************************************
+// File
+//*************************************************************************************
+
+SpeechResult<SessionSnapshot> SessionSnapshot::Load(std::string const& s_FilePath) noexcept
+{
+    int i_FileDescriptor = open(s_FilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    
+    if (i_FileDescriptor < 0)
+    {
+        return SpeechError{ "SessionSnapshot", "No snapshot: " + std::string(strerror(errno)) };
+    }
+    
+    // Only usable once, a snapshot which fails to restore should not
+    // be restored again on the next launch
+    unlink(s_FilePath.c_str());
+    
+    struct stat c_Stat;
+    
+    if (fstat(i_FileDescriptor, &c_Stat) < 0 || (size_t)c_Stat.st_size < sizeof(FileHeader))
+    {
+        close(i_FileDescriptor);
+        return SpeechError{ "SessionSnapshot", "Invalid snapshot size!" };
+    }
+    
+    size_t us_Size = c_Stat.st_size;
+    void* p_Address = mmap(NULL, us_Size, PROT_READ, MAP_PRIVATE, i_FileDescriptor, 0);
+    close(i_FileDescriptor);
+    
+    if (p_Address == MAP_FAILED)
+    {
+        return SpeechError{ "SessionSnapshot", "Failed to map snapshot: " + std::string(strerror(errno)) };
+    }
+    
+    const MRH_Uint8* p_Map = static_cast<const MRH_Uint8*>(p_Address);
+    FileHeader c_Header;
+    memcpy(&c_Header, p_Map, sizeof(FileHeader));
+    
+    // Snapshots of other builds might use a different state layout
+    if (memcmp(c_Header.p_Magic, p_SnapshotMagic, sizeof(p_SnapshotMagic)) != 0 ||
+        c_Header.u32_Version != u32_SnapshotVersion ||
+        c_Header.u32_Revision != u32_SnapshotRevision ||
+        c_Header.u32_OutputSize > SESSION_SNAPSHOT_STRING_MAX ||
+        c_Header.u32_InputSize > SESSION_SNAPSHOT_STRING_MAX ||
+        sizeof(FileHeader) + c_Header.u32_OutputSize + c_Header.u32_InputSize != us_Size)
+    {
+        munmap(p_Address, us_Size);
+        return SpeechError{ "SessionSnapshot", "Snapshot does not match this build!" };
+    }
+    
+    // An old session is no longer what the user expects to continue,
+    // a clock set back far is treated the same
+    MRH_Uint64 u64_Now = time(NULL);
+    
+    if (u64_Now > c_Header.u64_SavedS + SESSION_SNAPSHOT_MAX_AGE_S ||
+        c_Header.u64_SavedS > u64_Now + SESSION_SNAPSHOT_MAX_AGE_S)
+    {
+        munmap(p_Address, us_Size);
+        return SpeechError{ "SessionSnapshot", "Snapshot is too old!" };
+    }
+    
+    const char* p_Output = reinterpret_cast<const char*>(p_Map + sizeof(FileHeader));
+    const char* p_Input = p_Output + c_Header.u32_OutputSize;
+    
+    SessionSnapshot c_Snapshot(c_Header.u32_State,
+                               std::string(p_Output, c_Header.u32_OutputSize),
+                               std::string(p_Input, c_Header.u32_InputSize),
+                               (c_Header.u32_Flags & u32_FlagRecalled) != 0);
+    
+    munmap(p_Address, us_Size);
+    return c_Snapshot;
+}
+
+SpeechResult<void> SessionSnapshot::Save(std::string const& s_FilePath) const noexcept
+{
+    if (s_Output.size() > SESSION_SNAPSHOT_STRING_MAX || s_Input.size() > SESSION_SNAPSHOT_STRING_MAX)
+    {
+        return SpeechError{ "SessionSnapshot", "Session too large for snapshot!" };
+    }
+    
+    std::string s_TempPath = s_FilePath + ".tmp";
+    int i_FileDescriptor = open(s_TempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    
+    if (i_FileDescriptor < 0)
+    {
+        return SpeechError{ "SessionSnapshot", "Failed to open " + s_TempPath + ": " + std::string(strerror(errno)) };
+    }
+    
+    size_t us_Size = sizeof(FileHeader) + s_Output.size() + s_Input.size();
+    void* p_Address = MAP_FAILED;
+    
+    if (ftruncate(i_FileDescriptor, us_Size) == 0)
+    {
+        p_Address = mmap(NULL, us_Size, PROT_READ | PROT_WRITE, MAP_SHARED, i_FileDescriptor, 0);
+    }
+    
+    if (p_Address == MAP_FAILED)
+    {
+        close(i_FileDescriptor);
+        unlink(s_TempPath.c_str());
+        return SpeechError{ "SessionSnapshot", "Failed to map " + s_TempPath + ": " + std::string(strerror(errno)) };
+    }
+    
+    FileHeader c_Header;
+    memcpy(c_Header.p_Magic, p_SnapshotMagic, sizeof(p_SnapshotMagic));
+    c_Header.u32_Version = u32_SnapshotVersion;
+    c_Header.u32_Revision = u32_SnapshotRevision;
+    c_Header.u32_State = u32_State;
+    c_Header.u32_Flags = b_Recalled == true ? u32_FlagRecalled : 0;
+    c_Header.u32_OutputSize = s_Output.size();
+    c_Header.u32_InputSize = s_Input.size();
+    c_Header.u64_SavedS = time(NULL);
+    
+    MRH_Uint8* p_Map = static_cast<MRH_Uint8*>(p_Address);
+    memcpy(p_Map, &c_Header, sizeof(FileHeader));
+    memcpy(p_Map + sizeof(FileHeader), s_Output.data(), s_Output.size());
+    memcpy(p_Map + sizeof(FileHeader) + s_Output.size(), s_Input.data(), s_Input.size());
+    
+    bool b_Synced = msync(p_Address, us_Size, MS_SYNC) == 0;
+    munmap(p_Address, us_Size);
+    close(i_FileDescriptor);
+    
+    // Replace in one step, a crash leaves either the old or the new snapshot
+    if (b_Synced == false || rename(s_TempPath.c_str(), s_FilePath.c_str()) < 0)
+    {
+        unlink(s_TempPath.c_str());
+        return SpeechError{ "SessionSnapshot", "Failed to write " + s_FilePath + ": " + std::string(strerror(errno)) };
+    }
+    
+    return SpeechResult<void>();
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+MRH_Uint32 SessionSnapshot::GetState() const noexcept
+{
+    return u32_State;
+}
+
+std::string const& SessionSnapshot::GetOutput() const noexcept
+{
+    return s_Output;
+}
+
+std::string const& SessionSnapshot::GetInput() const noexcept
+{
+    return s_Input;
+}
+
+bool SessionSnapshot::GetRecalled() const noexcept
+{
+    return b_Recalled;
+}
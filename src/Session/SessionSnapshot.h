@@ -0,0 +1,147 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SessionSnapshot_h
+#define SessionSnapshot_h
+
+// C / C++
+#include <string>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+#include "../Module/SpeechResult.h"
+
+
+class SessionSnapshot
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param u32_State The session state.
+     *  \param s_Output The output given to ask for input.
+     *  \param s_Input The received input.
+     *  \param b_Recalled If the input was recalled from the history.
+     */
+    
+    SessionSnapshot(MRH_Uint32 u32_State, std::string s_Output, std::string s_Input, bool b_Recalled) noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~SessionSnapshot() noexcept;
+    
+    //*************************************************************************************
+    // File
+    //*************************************************************************************
+    
+    /**
+     *  Load a snapshot. The snapshot file is removed after loading,
+     *  snapshots saved too long ago are not loaded.
+     *
+     *  \param s_FilePath The full path to the snapshot file.
+     *
+     *  \return The loaded snapshot.
+     */
+    
+    static SpeechResult<SessionSnapshot> Load(std::string const& s_FilePath) noexcept;
+    
+    /**
+     *  Save the snapshot.
+     *
+     *  \param s_FilePath The full path to the snapshot file.
+     *
+     *  \return The save result.
+     */
+    
+    SpeechResult<void> Save(std::string const& s_FilePath) const noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the session state.
+     *
+     *  \return The session state.
+     */
+    
+    MRH_Uint32 GetState() const noexcept;
+    
+    /**
+     *  Get the output given to ask for input.
+     *
+     *  \return The asking output.
+     */
+    
+    std::string const& GetOutput() const noexcept;
+    
+    /**
+     *  Get the received input.
+     *
+     *  \return The received input.
+     */
+    
+    std::string const& GetInput() const noexcept;
+    
+    /**
+     *  Check if the input was recalled from the history.
+     *
+     *  \return true if recalled, false if not.
+     */
+    
+    bool GetRecalled() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct FileHeader
+    {
+        char p_Magic[8];
+        MRH_Uint32 u32_Version;
+        MRH_Uint32 u32_Revision;
+        MRH_Uint32 u32_State;
+        MRH_Uint32 u32_Flags;
+        MRH_Uint32 u32_OutputSize;
+        MRH_Uint32 u32_InputSize;
+        MRH_Uint64 u64_SavedS;
+    };
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    MRH_Uint32 u32_State;
+    std::string s_Output;
+    std::string s_Input;
+    bool b_Recalled;
+    
+protected:
+    
+};
+
+#endif /* SessionSnapshot_h */
@@ -0,0 +1,271 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <malloc.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <algorithm>
+#include <string>
+
+// External
+
+// Project
+#include "./SoakMonitor.h"
+
+// Pre-defined
+#ifndef SOAK_MONITOR_FILE
+    #define SOAK_MONITOR_FILE "Soak.csv"
+#endif
+#ifndef SOAK_MONITOR_WINDOW
+    #define SOAK_MONITOR_WINDOW 10000
+#endif
+#ifndef SOAK_MONITOR_WARMUP_WINDOWS
+    #define SOAK_MONITOR_WARMUP_WINDOWS 1
+#endif
+#ifndef SOAK_MONITOR_RSS_DRIFT_KB
+    #define SOAK_MONITOR_RSS_DRIFT_KB 2048
+#endif
+#ifndef SOAK_MONITOR_HEAP_DRIFT_KB
+    #define SOAK_MONITOR_HEAP_DRIFT_KB 512
+#endif
+#ifndef SOAK_MONITOR_FD_DRIFT
+    #define SOAK_MONITOR_FD_DRIFT 0
+#endif
+#ifndef SOAK_MONITOR_P99_DRIFT_FACTOR
+    #define SOAK_MONITOR_P99_DRIFT_FACTOR 2
+#endif
+#ifndef SOAK_MONITOR_P99_FLOOR_US
+    #define SOAK_MONITOR_P99_FLOOR_US 1000
+#endif
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+SoakMonitor::SoakMonitor() noexcept : c_CycleStart(std::chrono::steady_clock::now()),
+                                      u32_Window(0),
+                                      c_Baseline({ 0, 0, 0, 0 }),
+                                      p_Drift(NULL),
+                                      p_File(NULL)
+{
+    try
+    {
+        v_Latency.reserve(SOAK_MONITOR_WINDOW);
+    }
+    catch (...)
+    {}
+}
+
+SoakMonitor::~SoakMonitor() noexcept
+{
+    if (p_File != NULL)
+    {
+        fclose(p_File);
+    }
+}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+SoakMonitor& SoakMonitor::Singleton() noexcept
+{
+    static SoakMonitor c_SoakMonitor;
+    return c_SoakMonitor;
+}
+
+//*************************************************************************************
+// File
+//*************************************************************************************
+
+void SoakMonitor::Open(std::string const& s_Directory) noexcept
+{
+    if (p_File != NULL || s_Directory.size() == 0)
+    {
+        return;
+    }
+    
+    std::string s_FilePath = s_Directory + "/" SOAK_MONITOR_FILE;
+    
+    if ((p_File = fopen(s_FilePath.c_str(), "w")) == NULL)
+    {
+        MRH_ModuleLogger::Singleton().Log("SoakMonitor", "Failed to open " + s_FilePath,
+                                          "SoakMonitor.cpp", __LINE__);
+        return;
+    }
+    
+    fprintf(p_File, "window,rss_kb,heap_kb,fds,p99_us,status\n");
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+bool SoakMonitor::AddCycle() noexcept
+{
+    std::chrono::steady_clock::time_point c_Now = std::chrono::steady_clock::now();
+    MRH_Uint64 u64_Latency = std::chrono::duration_cast<std::chrono::microseconds>(c_Now - c_CycleStart).count();
+    c_CycleStart = c_Now;
+    
+    // Reserved on creation, no allocation during the soak
+    if (v_Latency.size() < v_Latency.capacity())
+    {
+        v_Latency.push_back(u64_Latency);
+    }
+    
+    if (v_Latency.size() < SOAK_MONITOR_WINDOW)
+    {
+        return true;
+    }
+    
+    Sample c_Sample = Take();
+    v_Latency.clear();
+    
+    // Warmup windows are skipped, the first window after them is
+    // the baseline
+    const char* p_Status = "ok";
+    
+    ++u32_Window;
+    
+    if (u32_Window <= SOAK_MONITOR_WARMUP_WINDOWS)
+    {
+        p_Status = "warmup";
+    }
+    else if (u32_Window == SOAK_MONITOR_WARMUP_WINDOWS + 1)
+    {
+        c_Baseline = c_Sample;
+        p_Status = "baseline";
+    }
+    else if ((p_Drift = Check(c_Sample)) != NULL)
+    {
+        p_Status = p_Drift;
+    }
+    
+    // @NOTE: The status of the last row tells a harness why the soak
+    //        ended, a drift names the metric
+    if (p_File != NULL)
+    {
+        fprintf(p_File, "%u,%llu,%llu,%llu,%llu,%s\n",
+                u32_Window,
+                (unsigned long long)(c_Sample.u64_RSS / 1024),
+                (unsigned long long)(c_Sample.u64_Heap / 1024),
+                (unsigned long long)c_Sample.u64_FileDescriptors,
+                (unsigned long long)c_Sample.u64_P99,
+                p_Status);
+        fflush(p_File);
+    }
+    
+    return p_Drift == NULL;
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+const char* SoakMonitor::GetDrift() const noexcept
+{
+    return p_Drift;
+}
+
+//*************************************************************************************
+// Sample
+//*************************************************************************************
+
+SoakMonitor::Sample SoakMonitor::Take() noexcept
+{
+    Sample c_Sample = { 0, 0, 0, 0 };
+    
+    // Resident pages are the second field
+    FILE* p_Statm = fopen("/proc/self/statm", "r");
+    
+    if (p_Statm != NULL)
+    {
+        unsigned long ul_Size;
+        unsigned long ul_Resident;
+        
+        if (fscanf(p_Statm, "%lu %lu", &ul_Size, &ul_Resident) == 2)
+        {
+            c_Sample.u64_RSS = (MRH_Uint64)ul_Resident * sysconf(_SC_PAGESIZE);
+        }
+        
+        fclose(p_Statm);
+    }
+    
+    c_Sample.u64_Heap = mallinfo2().uordblks;
+    
+    // Count without the directory entries and the descriptor used
+    // for reading the directory
+    DIR* p_Directory = opendir("/proc/self/fd");
+    
+    if (p_Directory != NULL)
+    {
+        while (readdir(p_Directory) != NULL)
+        {
+            ++c_Sample.u64_FileDescriptors;
+        }
+        
+        closedir(p_Directory);
+        c_Sample.u64_FileDescriptors -= 3;
+    }
+    
+    size_t us_Index = (v_Latency.size() * 99) / 100;
+    std::nth_element(v_Latency.begin(), v_Latency.begin() + us_Index, v_Latency.end());
+    c_Sample.u64_P99 = v_Latency[us_Index];
+    
+    return c_Sample;
+}
+
+const char* SoakMonitor::Check(Sample const& c_Sample) noexcept
+{
+    const char* p_Drift;
+    MRH_Uint64 u64_P99Max = c_Baseline.u64_P99 * SOAK_MONITOR_P99_DRIFT_FACTOR;
+    
+    // Very short cycles jitter too much for a relative bound
+    if (u64_P99Max < SOAK_MONITOR_P99_FLOOR_US)
+    {
+        u64_P99Max = SOAK_MONITOR_P99_FLOOR_US;
+    }
+    
+    
+    if (c_Sample.u64_RSS > c_Baseline.u64_RSS + (SOAK_MONITOR_RSS_DRIFT_KB * 1024))
+    {
+        p_Drift = "rss";
+    }
+    else if (c_Sample.u64_Heap > c_Baseline.u64_Heap + (SOAK_MONITOR_HEAP_DRIFT_KB * 1024))
+    {
+        p_Drift = "heap";
+    }
+    else if (c_Sample.u64_FileDescriptors > c_Baseline.u64_FileDescriptors + SOAK_MONITOR_FD_DRIFT)
+    {
+        p_Drift = "fds";
+    }
+    else if (c_Sample.u64_P99 > u64_P99Max)
+    {
+        p_Drift = "p99";
+    }
+    else
+    {
+        return NULL;
+    }
+    
+    MRH_ModuleLogger::Singleton().Log("SoakMonitor", std::string(p_Drift) +
+                                                     " drifted out of bounds in window " +
+                                                     std::to_string(u32_Window),
+                                      "SoakMonitor.cpp", __LINE__);
+    return p_Drift;
+}
@@ -0,0 +1,153 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SoakMonitor_h
+#define SoakMonitor_h
+
+// C / C++
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+
+
+class SoakMonitor
+{
+public:
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static SoakMonitor& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // File
+    //*************************************************************************************
+    
+    /**
+     *  Open the sample file. Samples are not recorded without it.
+     *
+     *  \param s_Directory The full path to the directory for the sample file.
+     */
+    
+    void Open(std::string const& s_Directory) noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Add a finished cycle. A sample is taken once a window is complete.
+     *
+     *  \return true if all metrics are within bounds, false if a metric drifted.
+     */
+    
+    bool AddCycle() noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the metric which drifted.
+     *
+     *  \return NULL if no metric drifted, the name of the drifted metric if one did.
+     */
+    
+    const char* GetDrift() const noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Sample
+    {
+        MRH_Uint64 u64_RSS;
+        MRH_Uint64 u64_Heap;
+        MRH_Uint64 u64_FileDescriptors;
+        MRH_Uint64 u64_P99;
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    SoakMonitor() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~SoakMonitor() noexcept;
+    
+    //*************************************************************************************
+    // Sample
+    //*************************************************************************************
+    
+    /**
+     *  Sample the process metrics for the current window.
+     *
+     *  \return The window sample.
+     */
+    
+    Sample Take() noexcept;
+    
+    /**
+     *  Check a window sample against the baseline.
+     *
+     *  \param c_Sample The sample to check.
+     *
+     *  \return NULL if within bounds, the name of the drifted metric if not.
+     */
+    
+    const char* Check(Sample const& c_Sample) noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::chrono::steady_clock::time_point c_CycleStart;
+    std::vector<MRH_Uint64> v_Latency;
+    
+    MRH_Uint32 u32_Window;
+    Sample c_Baseline;
+    const char* p_Drift;
+    
+    FILE* p_File;
+    
+protected:
+    
+};
+
+#endif /* SoakMonitor_h */
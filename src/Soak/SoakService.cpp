@@ -0,0 +1,150 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstring>
+#include <cstdio>
+
+// External
+
+// Project
+#include "./SoakService.h"
+
+// Pre-defined
+#ifndef SOAK_SERVICE_FLOOD_TYPE
+    #define SOAK_SERVICE_FLOOD_TYPE 1024
+#endif
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+SoakService::SoakService() noexcept : u32_Listened(0)
+{
+    // The route drops types above the platform events, platform floods
+    // cycle through the platform event types instead
+    c_Flood.u32_Type = SOAK_SERVICE_FLOOD_TYPE;
+    c_Flood.p_Data = NULL;
+    c_Flood.u32_DataSize = 0;
+}
+
+SoakService::~SoakService() noexcept
+{
+    for (MRH_Event* p_Event : dq_Response)
+    {
+        MRH_EVD_DestroyEvent(p_Event);
+    }
+}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+SoakService& SoakService::Singleton() noexcept
+{
+    static SoakService c_SoakService;
+    return c_SoakService;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void SoakService::Send(MRH_Event* p_Event) noexcept
+{
+    MRH_EvD_S_String_U c_Output;
+    
+    if (p_Event->u32_Type != MRH_EVENT_SAY_STRING_U ||
+        MRH_EVD_ReadEvent(&c_Output, p_Event->u32_Type, p_Event) < 0)
+    {
+        MRH_EVD_DestroyEvent(p_Event);
+        return;
+    }
+    
+    MRH_EVD_DestroyEvent(p_Event);
+    
+    // Every output is performed and followed by something heard, the
+    // listen result is only used if the app is listening at that time
+    MRH_EvD_S_String_S c_Performed;
+    memset(&c_Performed, 0, sizeof(c_Performed));
+    c_Performed.u32_ID = c_Output.u32_ID;
+    
+    MRH_EvD_L_String_S c_Listened;
+    memset(&c_Listened, 0, sizeof(c_Listened));
+    snprintf(c_Listened.p_String, MRH_EVD_L_STRING_BUFFER_MAX, "Soak utterance %u", ++u32_Listened);
+    
+    MRH_Event* p_Performed = MRH_EVD_CreateSetEvent(MRH_EVENT_SAY_STRING_S, &c_Performed);
+    MRH_Event* p_Listened = MRH_EVD_CreateSetEvent(MRH_EVENT_LISTEN_STRING_S, &c_Listened);
+    
+    try
+    {
+        if (p_Performed != NULL)
+        {
+            dq_Response.push_back(p_Performed);
+            p_Performed = NULL;
+        }
+        
+        if (p_Listened != NULL)
+        {
+            dq_Response.push_back(p_Listened);
+            p_Listened = NULL;
+        }
+    }
+    catch (std::exception& e)
+    {
+        if (p_Performed != NULL)
+        {
+            MRH_EVD_DestroyEvent(p_Performed);
+        }
+        
+        if (p_Listened != NULL)
+        {
+            MRH_EVD_DestroyEvent(p_Listened);
+        }
+    }
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+MRH_Event* SoakService::GetResponse() noexcept
+{
+    if (dq_Response.size() == 0)
+    {
+        return NULL;
+    }
+    
+    MRH_Event* p_Event = dq_Response.front();
+    dq_Response.pop_front();
+    
+    return p_Event;
+}
+
+const MRH_Event* SoakService::GetFlood() noexcept
+{
+#ifdef SOAK_SERVICE_FLOOD_PLATFORM
+    // Flood events have no data, skip the types answered above
+    do
+    {
+        c_Flood.u32_Type = (c_Flood.u32_Type + 1) % (MRH_EVENT_TYPE_MAX + 1);
+    }
+    while (c_Flood.u32_Type == MRH_EVENT_SAY_STRING_S || c_Flood.u32_Type == MRH_EVENT_LISTEN_STRING_S);
+#endif
+    
+    return &c_Flood;
+}
@@ -0,0 +1,110 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef SoakService_h
+#define SoakService_h
+
+// C / C++
+#include <deque>
+
+// External
+#include <libmrhab/Module/MRH_Module.h>
+
+// Project
+
+
+class SoakService
+{
+public:
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static SoakService& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Consume a event sent by the app and create the responses of the
+     *  speech service.
+     *
+     *  \param p_Event The sent event. The event is destroyed.
+     */
+    
+    void Send(MRH_Event* p_Event) noexcept;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the next response to receive. The caller owns the event.
+     *
+     *  \return The response event on success, NULL if none is pending.
+     */
+    
+    MRH_Event* GetResponse() noexcept;
+    
+    /**
+     *  Get a event of a other service, which the app does not use.
+     *  Platform floods return the next platform event type.
+     *
+     *  \return The flood event.
+     */
+    
+    const MRH_Event* GetFlood() noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    SoakService() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~SoakService() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::deque<MRH_Event*> dq_Response;
+    MRH_Uint32 u32_Listened;
+    
+    MRH_Event c_Flood;
+    
+protected:
+    
+};
+
+#endif /* SoakService_h */
@@ -0,0 +1,327 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+
+// External
+
+// Project
+#include <libmrhab.h>
+#include <libmrhab/MRH_StandIn.h>
+
+namespace
+{
+    MRH_StandInCounters c_Counters = { 0, 0, 0, 0, 0, 0, 0 };
+    
+    void AddUpdateTime(std::chrono::steady_clock::time_point c_Start) noexcept
+    {
+        c_Counters.u64_UpdateNS += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - c_Start).count();
+    }
+    
+    MRH_Event* CopyEvent(const MRH_Event* p_Event) noexcept
+    {
+        MRH_Event* p_Copy = (MRH_Event*)malloc(sizeof(MRH_Event));
+        
+        if (p_Copy == NULL)
+        {
+            return NULL;
+        }
+        
+        p_Copy->u32_Type = p_Event->u32_Type;
+        p_Copy->p_Data = NULL;
+        p_Copy->u32_DataSize = 0;
+        
+        if (p_Event->p_Data != NULL && p_Event->u32_DataSize > 0)
+        {
+            if ((p_Copy->p_Data = (MRH_Uint8*)malloc(p_Event->u32_DataSize)) == NULL)
+            {
+                free(p_Copy);
+                return NULL;
+            }
+            
+            memcpy(p_Copy->p_Data, p_Event->p_Data, p_Event->u32_DataSize);
+            p_Copy->u32_DataSize = p_Event->u32_DataSize;
+        }
+        
+        return p_Copy;
+    }
+}
+
+
+//*************************************************************************************
+// Constructor / Destructor
+//*************************************************************************************
+
+libmrhab::libmrhab(std::unique_ptr<MRH_Module> p_Module, [[maybe_unused]] int i_ThreadCount)
+{
+    if (!p_Module)
+    {
+        throw MRH_ABException("No module to start with!");
+    }
+    
+    v_Module.emplace_back(std::move(p_Module));
+}
+
+libmrhab::~libmrhab() noexcept
+{
+    for (MRH_Event* p_Event : dq_Job)
+    {
+        MRH_EVD_DestroyEvent(p_Event);
+    }
+}
+
+MRH_EventStorage::MRH_EventStorage() noexcept
+{}
+
+MRH_EventStorage::~MRH_EventStorage() noexcept
+{
+    for (MRH_Event* p_Event : dq_Event)
+    {
+        MRH_EVD_DestroyEvent(p_Event);
+    }
+}
+
+MRH_ModuleLogger::MRH_ModuleLogger() noexcept : p_File(stderr)
+{
+    const char* p_Path = getenv("MRH_STAND_IN_LOG");
+    
+    if (p_Path != NULL && (p_File = fopen(p_Path, "a")) == NULL)
+    {
+        p_File = stderr;
+    }
+}
+
+MRH_ModuleLogger::~MRH_ModuleLogger() noexcept
+{
+    if (p_File != stderr)
+    {
+        fclose(p_File);
+    }
+}
+
+//*************************************************************************************
+// Singleton
+//*************************************************************************************
+
+MRH_EventStorage& MRH_EventStorage::Singleton() noexcept
+{
+    static MRH_EventStorage c_EventStorage;
+    return c_EventStorage;
+}
+
+MRH_ModuleLogger& MRH_ModuleLogger::Singleton() noexcept
+{
+    static MRH_ModuleLogger c_ModuleLogger;
+    return c_ModuleLogger;
+}
+
+//*************************************************************************************
+// Update
+//*************************************************************************************
+
+void libmrhab::AddJob(const MRH_Event* p_Event)
+{
+    if (p_Event == NULL)
+    {
+        throw MRH_ABException("Invalid job event!");
+    }
+    
+    MRH_Event* p_Copy = CopyEvent(p_Event);
+    
+    if (p_Copy == NULL)
+    {
+        throw MRH_ABException("Failed to copy job event!");
+    }
+    
+    try
+    {
+        std::lock_guard<std::mutex> c_Guard(c_JobMutex);
+        dq_Job.push_back(p_Copy);
+        ++c_Counters.u64_Job;
+    }
+    catch (std::exception& e)
+    {
+        MRH_EVD_DestroyEvent(p_Copy);
+        throw MRH_ABException("Failed to add job: " + std::string(e.what()));
+    }
+}
+
+LIBMRHAB_UPDATE_RESULT libmrhab::Update()
+{
+    if (v_Module.size() == 0)
+    {
+        return LIBMRHAB_UPDATE_CLOSE_APP;
+    }
+    
+    // Jobs are run before the update, on the updating thread
+    std::deque<MRH_Event*> dq_Run;
+    
+    {
+        std::lock_guard<std::mutex> c_Guard(c_JobMutex);
+        dq_Run.swap(dq_Job);
+    }
+    
+    for (MRH_Event* p_Event : dq_Run)
+    {
+        MRH_Module& c_Module = *(v_Module.back());
+        
+        if (c_Module.CanHandleEvent(p_Event->u32_Type) == true)
+        {
+            ++c_Counters.u64_HandleEvent;
+            c_Module.HandleEvent(p_Event);
+        }
+        else
+        {
+            ++c_Counters.u64_JobDropped;
+        }
+        
+        MRH_EVD_DestroyEvent(p_Event);
+    }
+    
+    MRH_Module::Result e_Result;
+    
+    try
+    {
+        ++c_Counters.u64_Update;
+        
+        // Failing updates are timed until the exception is caught,
+        // the next module is requested like by a update
+        std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+        std::shared_ptr<MRH_Module> p_Next;
+        
+        try
+        {
+            e_Result = v_Module.back()->Update();
+            
+            if (e_Result == MRH_Module::FINISHED_APPEND || e_Result == MRH_Module::FINISHED_REPLACE)
+            {
+                p_Next = v_Module.back()->NextModule();
+            }
+        }
+        catch (...)
+        {
+            AddUpdateTime(c_Start);
+            throw;
+        }
+        
+        AddUpdateTime(c_Start);
+        
+        switch (e_Result)
+        {
+            case MRH_Module::IN_PROGRESS:
+                ++c_Counters.u64_InProgress;
+                return LIBMRHAB_UPDATE_SUCCESS;
+                
+            case MRH_Module::FINISHED_POP:
+                ++c_Counters.u64_Switch;
+                v_Module.pop_back();
+                break;
+                
+            case MRH_Module::FINISHED_APPEND:
+            case MRH_Module::FINISHED_REPLACE:
+            {
+                if (!p_Next)
+                {
+                    throw MRH_ABException(std::string(v_Module.back()->GetName()) + ": No module to switch to!");
+                }
+                
+                ++c_Counters.u64_Switch;
+                
+                if (e_Result == MRH_Module::FINISHED_REPLACE)
+                {
+                    v_Module.back() = std::move(p_Next);
+                }
+                else
+                {
+                    v_Module.emplace_back(std::move(p_Next));
+                }
+                break;
+            }
+                
+            default:
+                break;
+        }
+    }
+    catch (MRH_ABException& e)
+    {
+        throw;
+    }
+    catch (std::exception& e)
+    {
+        throw MRH_ABException("Module update failed: " + std::string(e.what()));
+    }
+    
+    return v_Module.size() == 0 ? LIBMRHAB_UPDATE_CLOSE_APP : LIBMRHAB_UPDATE_SUCCESS;
+}
+
+void MRH_EventStorage::Add(MRH_Event* p_Event)
+{
+    if (p_Event == NULL)
+    {
+        throw MRH_ABException("Invalid event!");
+    }
+    
+    try
+    {
+        std::lock_guard<std::mutex> c_Guard(c_Mutex);
+        dq_Event.push_back(p_Event);
+    }
+    catch (std::exception& e)
+    {
+        throw MRH_ABException("Failed to store event: " + std::string(e.what()));
+    }
+}
+
+//*************************************************************************************
+// Log
+//*************************************************************************************
+
+void MRH_ModuleLogger::Log(std::string const& s_Source, std::string const& s_Message, std::string const& s_File, int i_Line) noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    fprintf(p_File, "[%s] %s (%s:%d)\n", s_Source.c_str(), s_Message.c_str(), s_File.c_str(), i_Line);
+}
+
+//*************************************************************************************
+// Getters
+//*************************************************************************************
+
+MRH_Event* MRH_EventStorage::GetEvent(bool b_Remove) noexcept
+{
+    std::lock_guard<std::mutex> c_Guard(c_Mutex);
+    
+    if (dq_Event.size() == 0)
+    {
+        return NULL;
+    }
+    
+    MRH_Event* p_Event = dq_Event.front();
+    
+    if (b_Remove == true)
+    {
+        dq_Event.pop_front();
+    }
+    
+    return p_Event;
+}
+
+MRH_StandInCounters MRH_StandIn_GetCounters() noexcept
+{
+    return c_Counters;
+}
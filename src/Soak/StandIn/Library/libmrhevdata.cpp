@@ -0,0 +1,104 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstdlib>
+#include <cstring>
+
+// External
+
+// Project
+#include <libmrhevdata.h>
+
+namespace
+{
+    size_t GetDataSize(MRH_Uint32 u32_Type) noexcept
+    {
+        switch (u32_Type)
+        {
+            case MRH_EVENT_LISTEN_STRING_S:
+                return sizeof(MRH_EvD_L_String_S);
+            case MRH_EVENT_SAY_STRING_U:
+                return sizeof(MRH_EvD_S_String_U);
+            case MRH_EVENT_SAY_STRING_S:
+                return sizeof(MRH_EvD_S_String_S);
+                
+            default:
+                return 0;
+        }
+    }
+}
+
+
+//*************************************************************************************
+// Event
+//*************************************************************************************
+
+MRH_Event* MRH_EVD_CreateSetEvent(MRH_Uint32 u32_Type, const void* p_Data)
+{
+    size_t us_Size = GetDataSize(u32_Type);
+    
+    if (us_Size == 0 || p_Data == NULL)
+    {
+        return NULL;
+    }
+    
+    MRH_Event* p_Event = (MRH_Event*)malloc(sizeof(MRH_Event));
+    
+    if (p_Event == NULL)
+    {
+        return NULL;
+    }
+    else if ((p_Event->p_Data = (MRH_Uint8*)malloc(us_Size)) == NULL)
+    {
+        free(p_Event);
+        return NULL;
+    }
+    
+    // The data structure is stored as-is
+    memcpy(p_Event->p_Data, p_Data, us_Size);
+    p_Event->u32_Type = u32_Type;
+    p_Event->u32_DataSize = us_Size;
+    
+    return p_Event;
+}
+
+int MRH_EVD_ReadEvent(void* p_Data, MRH_Uint32 u32_Type, const MRH_Event* p_Event)
+{
+    size_t us_Size = GetDataSize(u32_Type);
+    
+    if (p_Data == NULL || p_Event == NULL || us_Size == 0 ||
+        p_Event->u32_Type != u32_Type ||
+        p_Event->u32_DataSize != us_Size ||
+        p_Event->p_Data == NULL)
+    {
+        return -1;
+    }
+    
+    memcpy(p_Data, p_Event->p_Data, us_Size);
+    return 0;
+}
+
+MRH_Event* MRH_EVD_DestroyEvent(MRH_Event* p_Event)
+{
+    if (p_Event != NULL)
+    {
+        free(p_Event->p_Data);
+        free(p_Event);
+    }
+    
+    return NULL;
+}
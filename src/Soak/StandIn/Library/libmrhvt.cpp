@@ -0,0 +1,144 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+
+// External
+
+// Project
+#include <libmrhvt/Output/MRH_OutputGenerator.h>
+#include <libmrhvt/String/MRH_LocalisedPath.h>
+
+// Pre-defined
+#ifndef MRH_STAND_IN_FSROOT
+    #define MRH_STAND_IN_FSROOT "res/pkg/FSRoot"
+#endif
+#ifndef MRH_STAND_IN_LOCALE
+    #define MRH_STAND_IN_LOCALE "en_US"
+#endif
+
+namespace
+{
+    bool GetValue(std::string const& s_Line, std::string const& s_Key, std::string& s_Value) noexcept
+    {
+        size_t us_Start = s_Line.find("<" + s_Key + "><");
+        size_t us_End = s_Line.rfind('>');
+        
+        if (us_Start == std::string::npos || us_End == std::string::npos)
+        {
+            return false;
+        }
+        
+        us_Start += s_Key.size() + 3;
+        
+        if (us_End < us_Start)
+        {
+            return false;
+        }
+        
+        s_Value = s_Line.substr(us_Start, us_End - us_Start);
+        return true;
+    }
+}
+
+
+//*************************************************************************************
+// Constructor
+//*************************************************************************************
+
+MRH_OutputGenerator::MRH_OutputGenerator(std::string const& s_FilePath)
+{
+    std::ifstream f_File(s_FilePath);
+    
+    if (f_File.is_open() == false)
+    {
+        throw MRH_VTException("Failed to open output file " + s_FilePath);
+    }
+    
+    std::string s_Line;
+    std::string s_Value;
+    
+    while (std::getline(f_File, s_Line))
+    {
+        if (GetValue(s_Line, "String", s_Value) == true)
+        {
+            v_Sentence.push_back({ s_Value, 1.0 });
+        }
+        else if (GetValue(s_Line, "Chance", s_Value) == true && v_Sentence.size() > 0)
+        {
+            v_Sentence.back().f64_Chance = atof(s_Value.c_str());
+        }
+    }
+    
+    if (v_Sentence.size() == 0)
+    {
+        throw MRH_VTException("No sentences in output file " + s_FilePath);
+    }
+}
+
+//*************************************************************************************
+// Generate
+//*************************************************************************************
+
+std::string MRH_OutputGenerator::Generate()
+{
+    double f64_Total = 0.0;
+    
+    for (auto const& Sentence : v_Sentence)
+    {
+        f64_Total += Sentence.f64_Chance;
+    }
+    
+    double f64_Pick = f64_Total * ((double)rand() / ((double)RAND_MAX + 1.0));
+    
+    for (auto const& Sentence : v_Sentence)
+    {
+        if (f64_Pick < Sentence.f64_Chance)
+        {
+            return Sentence.s_String;
+        }
+        
+        f64_Pick -= Sentence.f64_Chance;
+    }
+    
+    return v_Sentence.back().s_String;
+}
+
+//*************************************************************************************
+// Path
+//*************************************************************************************
+
+std::string MRH_LocalisedPath::GetPath(std::string const& s_Directory, std::string const& s_File)
+{
+    const char* p_Root = getenv("MRH_STAND_IN_FSROOT");
+    const char* p_Locale = getenv("MRH_STAND_IN_LOCALE");
+    
+    std::string s_Root = p_Root != NULL ? p_Root : MRH_STAND_IN_FSROOT;
+    std::string s_Path = s_Root + "/" + s_Directory + "/" + (p_Locale != NULL ? p_Locale : MRH_STAND_IN_LOCALE) + "/" + s_File;
+    
+    // Locales without the file use the default
+    std::error_code c_Error;
+    
+    if (std::filesystem::exists(s_Path, c_Error) == false)
+    {
+        s_Path = s_Root + "/" + s_Directory + "/Default/" + s_File;
+    }
+    
+    return s_Path;
+}
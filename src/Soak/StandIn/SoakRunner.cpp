@@ -0,0 +1,193 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <dlfcn.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <chrono>
+
+// External
+#include <libmrh/MRH_AppLoop.h>
+#include <libmrhevdata.h>
+#include <libmrhab/MRH_StandIn.h>
+
+// Project
+
+// Pre-defined
+#ifndef SOAK_RUNNER_UPDATE_LIMIT
+    #define SOAK_RUNNER_UPDATE_LIMIT 1000000000ULL
+#endif
+
+namespace
+{
+    typedef int (*Init)(const char*, int);
+    typedef void (*ReceiveEvent)(const MRH_Event*);
+    typedef MRH_Event* (*SendEvent)(void);
+    typedef int (*CanExit)(void);
+    typedef void (*Exit)(void);
+    typedef const char* (*SoakDrift)(void);
+    
+    struct Response
+    {
+        MRH_Uint64 u64_Due;
+        MRH_Event* p_Event;
+    };
+    
+    // Speech service, performs each output after the delay and hears
+    // a answer after the same delay again
+    std::deque<Response> dq_Response;
+    MRH_Uint32 u32_Listened = 0;
+    
+    void Respond(MRH_Event* p_Event, MRH_Uint64 u64_Due, MRH_Uint64 u64_Delay) noexcept
+    {
+        MRH_EvD_S_String_U c_Output;
+        
+        if (MRH_EVD_ReadEvent(&c_Output, MRH_EVENT_SAY_STRING_U, p_Event) < 0)
+        {
+            return;
+        }
+        
+        MRH_EvD_S_String_S c_Performed;
+        memset(&c_Performed, 0, sizeof(c_Performed));
+        c_Performed.u32_ID = c_Output.u32_ID;
+        
+        MRH_EvD_L_String_S c_Listened;
+        memset(&c_Listened, 0, sizeof(c_Listened));
+        snprintf(c_Listened.p_String, MRH_EVD_L_STRING_BUFFER_MAX, "Runner utterance %u", ++u32_Listened);
+        
+        dq_Response.push_back({ u64_Due, MRH_EVD_CreateSetEvent(MRH_EVENT_SAY_STRING_S, &c_Performed) });
+        dq_Response.push_back({ u64_Due + u64_Delay, MRH_EVD_CreateSetEvent(MRH_EVENT_LISTEN_STRING_S, &c_Listened) });
+    }
+}
+
+
+//*************************************************************************************
+// Main
+//*************************************************************************************
+
+int main(int argc, const char* argv[])
+{
+    if (argc < 2)
+    {
+        printf("Usage: %s <App.so> [Response Delay Updates] [Update Limit]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    MRH_Uint64 u64_Delay = argc > 2 ? strtoull(argv[2], NULL, 10) : 0;
+    MRH_Uint64 u64_Limit = argc > 3 ? strtoull(argv[3], NULL, 10) : SOAK_RUNNER_UPDATE_LIMIT;
+    
+    // The app resolves libmrhab from this process, so that the module
+    // calls it makes are counted here
+    void* p_App = dlopen(argv[1], RTLD_NOW | RTLD_LOCAL);
+    
+    if (p_App == NULL)
+    {
+        printf("Failed to load %s: %s\n", argv[1], dlerror());
+        return EXIT_FAILURE;
+    }
+    
+    Init AppInit = (Init)dlsym(p_App, "MRH_Init");
+    ReceiveEvent AppReceiveEvent = (ReceiveEvent)dlsym(p_App, "MRH_ReceiveEvent");
+    SendEvent AppSendEvent = (SendEvent)dlsym(p_App, "MRH_SendEvent");
+    CanExit AppCanExit = (CanExit)dlsym(p_App, "MRH_CanExit");
+    Exit AppExit = (Exit)dlsym(p_App, "MRH_Exit");
+    
+    // Only soak builds check for drift
+    SoakDrift AppSoakDrift = (SoakDrift)dlsym(p_App, "MRH_SoakDrift");
+    
+    if (AppInit == NULL || AppReceiveEvent == NULL || AppSendEvent == NULL || AppCanExit == NULL || AppExit == NULL)
+    {
+        printf("Missing app loop functions in %s\n", argv[1]);
+        dlclose(p_App);
+        return EXIT_FAILURE;
+    }
+    
+    std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+    
+    if (AppInit("", 0) < 0)
+    {
+        printf("Failed to initialize %s\n", argv[1]);
+        dlclose(p_App);
+        return EXIT_FAILURE;
+    }
+    
+    MRH_Uint64 u64_Update = 0;
+    
+    while (AppCanExit() < 0 && u64_Update < u64_Limit)
+    {
+        while (dq_Response.size() > 0 && dq_Response.front().u64_Due <= u64_Update)
+        {
+            if (dq_Response.front().p_Event != NULL)
+            {
+                AppReceiveEvent(dq_Response.front().p_Event);
+                MRH_EVD_DestroyEvent(dq_Response.front().p_Event);
+            }
+            
+            dq_Response.pop_front();
+        }
+        
+        // Each update sends until no event is left
+        MRH_Event* p_Event;
+        
+        while ((p_Event = AppSendEvent()) != NULL)
+        {
+            Respond(p_Event, u64_Update + 1 + u64_Delay, u64_Delay);
+            MRH_EVD_DestroyEvent(p_Event);
+        }
+        
+        ++u64_Update;
+    }
+    
+    AppExit();
+    
+    MRH_Uint64 u64_WallUS = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - c_Start).count();
+    MRH_StandInCounters c_Counters = MRH_StandIn_GetCounters();
+    
+    printf("Updates: %llu (%llu us)\n"
+           "Module calls: %llu (Update: %llu, in progress: %llu, HandleEvent: %llu)\n"
+           "Module update time: %llu ns\n"
+           "Module switches: %llu\n"
+           "Jobs: %llu (without module: %llu)\n",
+           (unsigned long long)u64_Update,
+           (unsigned long long)u64_WallUS,
+           (unsigned long long)(c_Counters.u64_Update + c_Counters.u64_HandleEvent),
+           (unsigned long long)c_Counters.u64_Update,
+           (unsigned long long)c_Counters.u64_InProgress,
+           (unsigned long long)c_Counters.u64_HandleEvent,
+           (unsigned long long)c_Counters.u64_UpdateNS,
+           (unsigned long long)c_Counters.u64_Switch,
+           (unsigned long long)c_Counters.u64_Job,
+           (unsigned long long)c_Counters.u64_JobDropped);
+    
+    // The monitor belongs to the app, check before unloading it
+    const char* p_Drift = AppSoakDrift != NULL ? AppSoakDrift() : NULL;
+    
+    if (p_Drift != NULL)
+    {
+        printf("Soak drift: %s\n", p_Drift);
+    }
+    
+    for (Response& c_Response : dq_Response)
+    {
+        MRH_EVD_DestroyEvent(c_Response.p_Event);
+    }
+    
+    dlclose(p_App);
+    return u64_Update < u64_Limit && p_Drift == NULL ? EXIT_SUCCESS : EXIT_FAILURE;
+}
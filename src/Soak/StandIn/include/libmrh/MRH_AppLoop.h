@@ -0,0 +1,82 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_AppLoop_h
+#define MRH_AppLoop_h
+
+// C / C++
+
+// External
+
+// Project
+#include "./MRH_Event.h"
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    
+    //*************************************************************************************
+    // App Loop
+    //*************************************************************************************
+    
+    /**
+     *  Initialize the app.
+     *
+     *  \param p_LaunchInput The launch input string.
+     *  \param i_LaunchCommandID The launch command id.
+     *
+     *  \return 0 on success, -1 on failure.
+     */
+    
+    int MRH_Init(const char* p_LaunchInput, int i_LaunchCommandID);
+    
+    /**
+     *  Receive a event from the platform. The event is owned by the caller.
+     *
+     *  \param p_Event The received event.
+     */
+    
+    void MRH_ReceiveEvent(const MRH_Event* p_Event);
+    
+    /**
+     *  Send a event to the platform. The caller owns the returned event.
+     *
+     *  \return The event to send on success, NULL if none is left.
+     */
+    
+    MRH_Event* MRH_SendEvent(void);
+    
+    /**
+     *  Check if the app can exit.
+     *
+     *  \return 0 if the app can exit, -1 if not.
+     */
+    
+    int MRH_CanExit(void);
+    
+    /**
+     *  Deinitialize the app.
+     */
+    
+    void MRH_Exit(void);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MRH_AppLoop_h */
@@ -0,0 +1,44 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_Event_h
+#define MRH_Event_h
+
+// C / C++
+
+// External
+
+// Project
+#include "./MRH_Typedefs.h"
+
+
+typedef struct MRH_Event_t
+{
+    MRH_Uint32 u32_Type;
+    MRH_Uint8* p_Data;
+    MRH_Uint32 u32_DataSize;
+    
+}MRH_Event;
+
+// Event types used by the app, all below the platform maximum
+#define MRH_EVENT_UNK 0
+#define MRH_EVENT_LISTEN_STRING_S 6
+#define MRH_EVENT_SAY_STRING_U 10
+#define MRH_EVENT_SAY_STRING_S 11
+
+#define MRH_EVENT_TYPE_MAX MRH_EVENT_SAY_STRING_S
+
+#endif /* MRH_Event_h */
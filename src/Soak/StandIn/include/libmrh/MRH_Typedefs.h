@@ -0,0 +1,40 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_Typedefs_h
+#define MRH_Typedefs_h
+
+// C / C++
+#include <stdint.h>
+
+// External
+
+// Project
+
+
+// @NOTE: Stand-in for the libmrh types, used to build and run the app
+//        without the platform libraries!
+typedef uint8_t MRH_Uint8;
+typedef uint16_t MRH_Uint16;
+typedef uint32_t MRH_Uint32;
+typedef uint64_t MRH_Uint64;
+
+typedef int8_t MRH_Sint8;
+typedef int16_t MRH_Sint16;
+typedef int32_t MRH_Sint32;
+typedef int64_t MRH_Sint64;
+
+#endif /* MRH_Typedefs_h */
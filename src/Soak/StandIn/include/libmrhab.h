@@ -0,0 +1,98 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libmrhab_h
+#define libmrhab_h
+
+// C / C++
+#include <memory>
+#include <vector>
+#include <deque>
+#include <mutex>
+
+// External
+
+// Project
+#include "./libmrhab/Module/MRH_Module.h"
+
+
+typedef enum
+{
+    LIBMRHAB_UPDATE_SUCCESS = 0,
+    LIBMRHAB_UPDATE_CLOSE_APP = 1
+    
+}LIBMRHAB_UPDATE_RESULT;
+
+class libmrhab
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param p_Module The first module to run.
+     *  \param i_ThreadCount The callback thread count. Jobs are always run
+     *                       on the updating thread by the stand-in.
+     */
+    
+    libmrhab(std::unique_ptr<MRH_Module> p_Module, int i_ThreadCount);
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~libmrhab() noexcept;
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Add a job for a received event. The event is copied.
+     *
+     *  \param p_Event The received event.
+     */
+    
+    void AddJob(const MRH_Event* p_Event);
+    
+    /**
+     *  Run the added jobs and update the current module.
+     *
+     *  \return The update result.
+     */
+    
+    LIBMRHAB_UPDATE_RESULT Update();
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::vector<std::shared_ptr<MRH_Module>> v_Module;
+    
+    std::deque<MRH_Event*> dq_Job;
+    std::mutex c_JobMutex;
+    
+protected:
+    
+};
+
+#endif /* libmrhab_h */
@@ -0,0 +1,81 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_ABException_h
+#define MRH_ABException_h
+
+// C / C++
+#include <stdexcept>
+#include <string>
+
+// External
+
+// Project
+
+
+class MRH_ABException : public std::runtime_error
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param s_Message The error message.
+     */
+    
+    MRH_ABException(std::string const& s_Message) : std::runtime_error(s_Message)
+    {}
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the error message.
+     *
+     *  \return The error message.
+     */
+    
+    std::string what2() const noexcept
+    {
+        return what();
+    }
+};
+
+class MRH_ModuleException : public MRH_ABException
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param s_Module The name of the module which failed.
+     *  \param s_Message The error message.
+     */
+    
+    MRH_ModuleException(std::string const& s_Module, std::string const& s_Message) : MRH_ABException(s_Module + ": " + s_Message)
+    {}
+};
+
+#endif /* MRH_ABException_h */
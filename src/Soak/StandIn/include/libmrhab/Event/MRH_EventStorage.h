@@ -0,0 +1,103 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_EventStorage_h
+#define MRH_EventStorage_h
+
+// C / C++
+#include <deque>
+#include <mutex>
+
+// External
+#include <libmrhevdata.h>
+
+// Project
+#include "../Error/MRH_ABException.h"
+
+
+class MRH_EventStorage
+{
+public:
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static MRH_EventStorage& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Add
+    //*************************************************************************************
+    
+    /**
+     *  Add a event to send. The storage owns the event on success.
+     *
+     *  \param p_Event The event to add.
+     */
+    
+    void Add(MRH_Event* p_Event);
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Get the next event to send.
+     *
+     *  \param b_Remove Remove the event from the storage. The caller owns
+     *                  removed events.
+     *
+     *  \return The event on success, NULL if none is stored.
+     */
+    
+    MRH_Event* GetEvent(bool b_Remove) noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    MRH_EventStorage() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~MRH_EventStorage() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::deque<MRH_Event*> dq_Event;
+    std::mutex c_Mutex;
+    
+protected:
+    
+};
+
+#endif /* MRH_EventStorage_h */
@@ -0,0 +1,55 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_StandIn_h
+#define MRH_StandIn_h
+
+// C / C++
+
+// External
+#include <libmrh.h>
+
+// Project
+
+
+// @NOTE: Only part of the stand-in, used by the soak runner to count
+//        module calls. Apps never use this!
+struct MRH_StandInCounters
+{
+    // Module calls by libmrhab
+    MRH_Uint64 u64_Update;
+    MRH_Uint64 u64_InProgress;
+    MRH_Uint64 u64_HandleEvent;
+    MRH_Uint64 u64_Switch;
+    
+    // Time spent in module updates and next module requests, until
+    // they returned or threw
+    MRH_Uint64 u64_UpdateNS;
+    
+    // Jobs added and dropped without a module to handle them
+    MRH_Uint64 u64_Job;
+    MRH_Uint64 u64_JobDropped;
+};
+
+/**
+ *  Get the module call counters of all libmrhab instances.
+ *
+ *  \return The current counters.
+ */
+
+MRH_StandInCounters MRH_StandIn_GetCounters() noexcept;
+
+#endif /* MRH_StandIn_h */
@@ -0,0 +1,140 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_Module_h
+#define MRH_Module_h
+
+// C / C++
+#include <memory>
+#include <string>
+
+// External
+#include <libmrh.h>
+#include <libmrhevdata.h>
+
+// Project
+#include "../Error/MRH_ABException.h"
+#include "../Event/MRH_EventStorage.h"
+#include "./MRH_ModuleLogger.h"
+#include "./MRH_ModuleTimer.h"
+
+
+class MRH_Module
+{
+public:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    enum Result
+    {
+        IN_PROGRESS = 0,
+        FINISHED_POP = 1,
+        FINISHED_APPEND = 2,
+        FINISHED_REPLACE = 3,
+        
+        RESULT_MAX = FINISHED_REPLACE,
+        
+        RESULT_COUNT = RESULT_MAX + 1
+    };
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     *
+     *  \param p_Name The module name.
+     */
+    
+    MRH_Module(const char* p_Name) noexcept : p_Name(p_Name)
+    {}
+    
+    /**
+     *  Default destructor.
+     */
+    
+    virtual ~MRH_Module() noexcept
+    {}
+    
+    //*************************************************************************************
+    // Update
+    //*************************************************************************************
+    
+    /**
+     *  Hand a received event to the module.
+     *
+     *  \param p_Event The received event.
+     */
+    
+    virtual void HandleEvent(const MRH_Event* p_Event) noexcept = 0;
+    
+    /**
+     *  Perform a module update.
+     *
+     *  \return The module update result.
+     */
+    
+    virtual Result Update() = 0;
+    
+    /**
+     *  Get the module to switch to.
+     *
+     *  \return The module to switch to.
+     */
+    
+    virtual std::shared_ptr<MRH_Module> NextModule() = 0;
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the module can handle a event.
+     *
+     *  \param u32_Type The type of the event to handle.
+     *
+     *  \return true if the event can be used, false if not.
+     */
+    
+    virtual bool CanHandleEvent(MRH_Uint32 u32_Type) noexcept = 0;
+    
+    /**
+     *  Get the module name.
+     *
+     *  \return The module name.
+     */
+    
+    const char* GetName() const noexcept
+    {
+        return p_Name;
+    }
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    const char* p_Name;
+    
+protected:
+    
+};
+
+#endif /* MRH_Module_h */
@@ -0,0 +1,91 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_ModuleLogger_h
+#define MRH_ModuleLogger_h
+
+// C / C++
+#include <string>
+#include <mutex>
+#include <cstdio>
+
+// External
+
+// Project
+
+
+class MRH_ModuleLogger
+{
+public:
+    
+    //*************************************************************************************
+    // Singleton
+    //*************************************************************************************
+    
+    /**
+     *  Get the class instance.
+     *
+     *  \return The class instance.
+     */
+    
+    static MRH_ModuleLogger& Singleton() noexcept;
+    
+    //*************************************************************************************
+    // Log
+    //*************************************************************************************
+    
+    /**
+     *  Log a message. Messages are written to the file given by the
+     *  MRH_STAND_IN_LOG environment variable, stderr if not set.
+     *
+     *  \param s_Source The message source.
+     *  \param s_Message The message.
+     *  \param s_File The source file.
+     *  \param i_Line The source line.
+     */
+    
+    void Log(std::string const& s_Source, std::string const& s_Message, std::string const& s_File, int i_Line) noexcept;
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor / Destructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    MRH_ModuleLogger() noexcept;
+    
+    /**
+     *  Default destructor.
+     */
+    
+    ~MRH_ModuleLogger() noexcept;
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    FILE* p_File;
+    std::mutex c_Mutex;
+    
+protected:
+    
+};
+
+#endif /* MRH_ModuleLogger_h */
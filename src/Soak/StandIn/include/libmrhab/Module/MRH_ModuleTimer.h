@@ -0,0 +1,73 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_ModuleTimer_h
+#define MRH_ModuleTimer_h
+
+// C / C++
+#include <chrono>
+
+// External
+#include <libmrh.h>
+
+// Project
+
+
+class MRH_ModuleTimer
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. The timer starts on creation.
+     *
+     *  \param u32_TimeoutMS The time in milliseconds until the timer finishes.
+     */
+    
+    MRH_ModuleTimer(MRH_Uint32 u32_TimeoutMS) noexcept : c_End(std::chrono::steady_clock::now() + std::chrono::milliseconds(u32_TimeoutMS))
+    {}
+    
+    //*************************************************************************************
+    // Getters
+    //*************************************************************************************
+    
+    /**
+     *  Check if the timer finished.
+     *
+     *  \return true if finished, false if not.
+     */
+    
+    bool GetTimerFinished() const noexcept
+    {
+        return std::chrono::steady_clock::now() >= c_End;
+    }
+    
+private:
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::chrono::steady_clock::time_point c_End;
+    
+protected:
+    
+};
+
+#endif /* MRH_ModuleTimer_h */
@@ -0,0 +1,104 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libmrhevdata_h
+#define libmrhevdata_h
+
+// C / C++
+
+// External
+#include <libmrh.h>
+
+// Project
+
+// Pre-defined
+#define MRH_EVD_S_STRING_BUFFER_MAX 1024
+#define MRH_EVD_S_STRING_BUFFER_MAX_TERMINATED (MRH_EVD_S_STRING_BUFFER_MAX + 1)
+#define MRH_EVD_L_STRING_BUFFER_MAX 1024
+#define MRH_EVD_L_STRING_BUFFER_MAX_TERMINATED (MRH_EVD_L_STRING_BUFFER_MAX + 1)
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    typedef struct MRH_EvD_L_String_S_t
+    {
+        char p_String[MRH_EVD_L_STRING_BUFFER_MAX_TERMINATED];
+        MRH_Uint32 u32_ID;
+        
+    }MRH_EvD_L_String_S;
+    
+    typedef struct MRH_EvD_S_String_U_t
+    {
+        char p_String[MRH_EVD_S_STRING_BUFFER_MAX_TERMINATED];
+        MRH_Uint32 u32_ID;
+        
+    }MRH_EvD_S_String_U;
+    
+    typedef struct MRH_EvD_S_String_S_t
+    {
+        MRH_Uint32 u32_ID;
+        
+    }MRH_EvD_S_String_S;
+    
+    //*************************************************************************************
+    // Event
+    //*************************************************************************************
+    
+    /**
+     *  Create a event with the given event data.
+     *
+     *  \param u32_Type The event type.
+     *  \param p_Data The event data structure matching the type.
+     *
+     *  \return The event on success, NULL on failure.
+     */
+    
+    MRH_Event* MRH_EVD_CreateSetEvent(MRH_Uint32 u32_Type, const void* p_Data);
+    
+    /**
+     *  Read the event data of a event.
+     *
+     *  \param p_Data The event data structure matching the type.
+     *  \param u32_Type The event type.
+     *  \param p_Event The event to read.
+     *
+     *  \return 0 on success, -1 on failure.
+     */
+    
+    int MRH_EVD_ReadEvent(void* p_Data, MRH_Uint32 u32_Type, const MRH_Event* p_Event);
+    
+    /**
+     *  Destroy a event.
+     *
+     *  \param p_Event The event to destroy.
+     *
+     *  \return Always NULL.
+     */
+    
+    MRH_Event* MRH_EVD_DestroyEvent(MRH_Event* p_Event);
+    
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* libmrhevdata_h */
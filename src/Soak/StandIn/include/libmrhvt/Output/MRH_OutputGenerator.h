@@ -0,0 +1,81 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_OutputGenerator_h
+#define MRH_OutputGenerator_h
+
+// C / C++
+#include <string>
+#include <vector>
+
+// External
+
+// Project
+#include "../Error/MRH_VTException.h"
+
+
+class MRH_OutputGenerator
+{
+public:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor. Only the sentence strings and chances of
+     *  the output file are read by the stand-in.
+     *
+     *  \param s_FilePath The full path to the output file.
+     */
+    
+    MRH_OutputGenerator(std::string const& s_FilePath);
+    
+    //*************************************************************************************
+    // Generate
+    //*************************************************************************************
+    
+    /**
+     *  Generate a output string.
+     *
+     *  \return The output string.
+     */
+    
+    std::string Generate();
+    
+private:
+    
+    //*************************************************************************************
+    // Types
+    //*************************************************************************************
+    
+    struct Sentence
+    {
+        std::string s_String;
+        double f64_Chance;
+    };
+    
+    //*************************************************************************************
+    // Data
+    //*************************************************************************************
+    
+    std::vector<Sentence> v_Sentence;
+    
+protected:
+    
+};
+
+#endif /* MRH_OutputGenerator_h */
@@ -0,0 +1,66 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef MRH_LocalisedPath_h
+#define MRH_LocalisedPath_h
+
+// C / C++
+#include <string>
+
+// External
+
+// Project
+#include "../Error/MRH_VTException.h"
+
+
+class MRH_LocalisedPath
+{
+public:
+    
+    //*************************************************************************************
+    // Path
+    //*************************************************************************************
+    
+    /**
+     *  Get the path of a localised file. The stand-in uses the package
+     *  FSRoot given by MRH_STAND_IN_FSROOT and the locale given by
+     *  MRH_STAND_IN_LOCALE.
+     *
+     *  \param s_Directory The directory in the package FSRoot.
+     *  \param s_File The file name.
+     *
+     *  \return The full path to the localised file.
+     */
+    
+    static std::string GetPath(std::string const& s_Directory, std::string const& s_File);
+    
+private:
+    
+    //*************************************************************************************
+    // Constructor
+    //*************************************************************************************
+    
+    /**
+     *  Default constructor.
+     */
+    
+    MRH_LocalisedPath() noexcept = delete;
+    
+protected:
+    
+};
+
+#endif /* MRH_LocalisedPath_h */
@@ -0,0 +1,139 @@
+/**
+ *  Copyright (C) 2021 - 2022 The MRH Project Authors.
+ * 
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// C / C++
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <chrono>
+
+// External
+
+// Project
+#include "../Module/SpeechText.h"
+
+// Pre-defined
+#ifndef TEXT_BENCH_LENGTH
+    #define TEXT_BENCH_LENGTH 256
+#endif
+#ifndef TEXT_BENCH_ITERATIONS
+    #define TEXT_BENCH_ITERATIONS 20000
+#endif
+#ifndef TEXT_BENCH_ROUNDS
+    #define TEXT_BENCH_ROUNDS 30
+#endif
+
+namespace
+{
+    struct Input
+    {
+        const char* p_Name;
+        std::string s_Text;
+    };
+    
+    std::string Repeat(std::string const& s_Pattern, size_t us_Length)
+    {
+        std::string s_Text;
+        
+        while (s_Text.size() < us_Length)
+        {
+            s_Text += s_Pattern;
+        }
+        
+        // Don't cut a multi byte sequence
+        while (s_Text.size() > us_Length && (static_cast<unsigned char>(s_Text[us_Length]) & 0xC0) == 0x80)
+        {
+            ++us_Length;
+        }
+        
+        s_Text.resize(us_Length);
+        return s_Text;
+    }
+}
+
+
+//*************************************************************************************
+// Main
+//*************************************************************************************
+
+int main(int argc, const char* argv[])
+{
+    size_t us_Length = argc > 1 ? strtoull(argv[1], NULL, 10) : TEXT_BENCH_LENGTH;
+    size_t us_Iterations = argc > 2 ? strtoull(argv[2], NULL, 10) : TEXT_BENCH_ITERATIONS;
+    
+    if (us_Length < 2 || us_Iterations == 0)
+    {
+        printf("Usage: %s [Input Length] [Iterations]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    
+    // The invalid input is only rejected at its last bytes, after
+    // the rest was normalized
+    std::vector<Input> v_Input =
+    {
+        { "ascii", Repeat("Please repeat what I just said to you. ", us_Length) },
+        { "whitespace", Repeat("say  \t\r\n   this\x01\x02   ", us_Length) },
+        { "multibyte", Repeat("\xC3\x84\xC3\xB6\xC3\x9F\xE2\x82\xAC\xE6\x97\xA5\xE6\x9C\xAC\xF0\x9F\x98\x80", us_Length) },
+        { "invalid", Repeat("Please repeat what I just said to you. ", us_Length - 2) + "\xC3\x28" }
+    };
+    
+#ifdef SPEECH_TEXT_SCALAR
+    printf("Path: scalar, length: %zu, iterations: %zu\n", us_Length, us_Iterations);
+#else
+    printf("Path: default, length: %zu, iterations: %zu\n", us_Length, us_Iterations);
+#endif
+    
+    for (Input const& c_Input : v_Input)
+    {
+        std::string s_Output(c_Input.s_Text.size(), '\0');
+        size_t us_Written = 0;
+        bool b_Valid = false;
+        
+        // The checksum has to match between both paths
+        unsigned long long u64_Checksum = 0;
+        double f64_NS = 0.0;
+        
+        // Other load only slows a round down, the fastest one is kept
+        for (size_t r = 0; r < TEXT_BENCH_ROUNDS; ++r)
+        {
+            std::chrono::steady_clock::time_point c_Start = std::chrono::steady_clock::now();
+            
+            for (size_t i = 0; i < us_Iterations; ++i)
+            {
+                b_Valid = SpeechText::Normalize(c_Input.s_Text.data(), c_Input.s_Text.size(), s_Output.data(), us_Written, true);
+                u64_Checksum += us_Written + (us_Written > 0 ? static_cast<unsigned char>(s_Output[i % us_Written]) : 0);
+            }
+            
+            double f64_RoundNS = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - c_Start).count();
+            
+            if (r == 0 || f64_RoundNS < f64_NS)
+            {
+                f64_NS = f64_RoundNS;
+            }
+        }
+        
+        printf("%-10s  %8.1f ns/call  %8.1f MB/s  valid: %d  written: %zu  checksum: %llu\n",
+               c_Input.p_Name,
+               f64_NS / us_Iterations,
+               (c_Input.s_Text.size() * us_Iterations * 1000.0) / f64_NS,
+               b_Valid == true ? 1 : 0,
+               us_Written,
+               u64_Checksum);
+    }
+    
+    return EXIT_SUCCESS;
+}